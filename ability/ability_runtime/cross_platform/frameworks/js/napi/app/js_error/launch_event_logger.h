@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ABILITY_RUNTIME_LAUNCH_EVENT_LOGGER_H
+#define OHOS_ABILITY_RUNTIME_LAUNCH_EVENT_LOGGER_H
+
+#include <cstdint>
+#include <string>
+
+namespace OHOS {
+namespace AbilityRuntime {
+struct LaunchEventInfo {
+    std::string appRunningId;
+    int32_t pid;
+    int32_t uid;
+    std::string bundleName;
+    std::string versionName;
+    int64_t totalTime;
+    std::string timeline;
+};
+
+class LaunchEventLogger {
+public:
+    static void SendLaunchEvent(const LaunchEventInfo& info);
+};
+}  // namespace AbilityRuntime
+}  // namespace OHOS
+#endif // OHOS_ABILITY_RUNTIME_LAUNCH_EVENT_LOGGER_H
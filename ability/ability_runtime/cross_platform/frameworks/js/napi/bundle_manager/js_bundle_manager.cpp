@@ -14,6 +14,8 @@
  */
 #include "js_bundle_manager.h"
 
+#include <mutex>
+
 #include "bundle_container.h"
 #include "js_runtime_utils.h"
 #include "napi_common_bundle_info.h"
@@ -28,6 +30,34 @@ constexpr size_t ARGS_POS_ZERO = 0;
 constexpr size_t ARGS_POS_ONE = 1;
 constexpr size_t ARGS_POS_TWO = 2;
 
+namespace {
+std::mutex g_selfBundleMutex;
+uint64_t g_selfModuleGeneration = 0;
+std::shared_ptr<BundleContainer> g_selfBundleContainer;
+
+// Parsing every module.json is the expensive part of a self query, so the parsed container and its snapshots
+// are reused until StageAssetManager reports a module change.
+std::shared_ptr<BundleContainer> GetSelfBundleContainer()
+{
+    auto stageAssetManager = StageAssetManager::GetInstance();
+    // Read before the module list, a change racing with the rebuild leaves the older value and reloads next time.
+    uint64_t generation = stageAssetManager->GetModuleGeneration();
+    std::lock_guard<std::mutex> lock(g_selfBundleMutex);
+    if (g_selfBundleContainer != nullptr && g_selfModuleGeneration == generation) {
+        return g_selfBundleContainer;
+    }
+    auto moduleList = stageAssetManager->GetModuleJsonBufferList();
+    if (moduleList.empty()) {
+        return nullptr;
+    }
+    auto bundleContainer = std::make_shared<BundleContainer>();
+    bundleContainer->LoadBundleInfos(moduleList);
+    g_selfBundleContainer = std::move(bundleContainer);
+    g_selfModuleGeneration = generation;
+    return g_selfBundleContainer;
+}
+} // namespace
+
 void JsBundleManager::Finalizer(napi_env env, void* data, void* hint)
 {
     std::unique_ptr<JsBundleManager>(static_cast<JsBundleManager*>(data));
@@ -54,16 +84,11 @@ napi_value JsBundleManager::OnGetBundleInfoForSelfSync(napi_env env, NapiCallbac
         LOGE("parseInt invalid");
         return NapiCommonBundleInfo::ThrowJsError(env, static_cast<int32_t>(ERROR_CODE::INCORRECT_PARAMETERS));
     }
-    std::shared_ptr<BundleContainer> bundleContainer = std::make_shared<BundleContainer>();
+    std::shared_ptr<BundleContainer> bundleContainer = GetSelfBundleContainer();
     if (bundleContainer == nullptr) {
         return CreateJsUndefined(env);
     }
-    auto moduleList = StageAssetManager::GetInstance()->GetModuleJsonBufferList();
-    if (moduleList.empty()) {
-        return CreateJsUndefined(env);
-    }
-    bundleContainer->LoadBundleInfos(moduleList);
-    std::shared_ptr<BundleInfo> bundleInfo = bundleContainer->GetBundleInfoV9(flag);
+    std::shared_ptr<const BundleInfo> bundleInfo = bundleContainer->GetBundleInfoV9Snapshot(flag);
     napi_value result = nullptr;
     if (bundleInfo != nullptr) {
         NAPI_CALL(env, napi_create_object(env, &result));
@@ -84,20 +109,13 @@ napi_value JsBundleManager::OnGetBundleInfoForSelf(napi_env env, NapiCallbackInf
         return NapiCommonBundleInfo::ThrowJsError(env, static_cast<int32_t>(ERROR_CODE::INCORRECT_PARAMETERS));
     }
     auto complete = [flag](napi_env env, NapiAsyncTask& task, int32_t status) {
-        std::shared_ptr<BundleContainer> bundleContainer = std::make_shared<BundleContainer>();
+        std::shared_ptr<BundleContainer> bundleContainer = GetSelfBundleContainer();
         if (bundleContainer == nullptr) {
-            task.Reject(env,
-                CreateJsError(env, static_cast<int32_t>(ERROR_CODE::INCORRECT_PARAMETERS), "callback is nullptr"));
-            return;
-        }
-        auto moduleList = StageAssetManager::GetInstance()->GetModuleJsonBufferList();
-        if (moduleList.empty()) {
             task.Reject(env,
                 CreateJsError(env, static_cast<int32_t>(ERROR_CODE::INCORRECT_PARAMETERS), "moduleList is nullptr"));
             return;
         }
-        bundleContainer->LoadBundleInfos(moduleList);
-        std::shared_ptr<BundleInfo> bundleInfo = bundleContainer->GetBundleInfoV9(flag);
+        std::shared_ptr<const BundleInfo> bundleInfo = bundleContainer->GetBundleInfoV9Snapshot(flag);
         if (bundleInfo != nullptr) {
             napi_value res = nullptr;
             napi_create_object(env, &res);
@@ -52,36 +52,34 @@ napi_value CreateJsWantParams(napi_env env, const AAFwk::WantParams& wantParams)
     napi_value object = nullptr;
     napi_create_object(env, &object);
 
-    const std::map<std::string, sptr<AAFwk::IInterface>> paramList = wantParams.GetParams();
-    for (auto iter = paramList.begin(); iter != paramList.end(); iter++) {
-        if (AAFwk::IString::Query(iter->second) != nullptr) {
-            InnerWrapJsWantParams<AAFwk::IString, AAFwk::String, std::string>(env, object, iter->first, wantParams);
-        } else if (AAFwk::IBoolean::Query(iter->second) != nullptr) {
-            InnerWrapJsWantParams<AAFwk::IBoolean, AAFwk::Boolean, bool>(env, object, iter->first, wantParams);
-        } else if (AAFwk::IShort::Query(iter->second) != nullptr) {
-            InnerWrapJsWantParams<AAFwk::IShort, AAFwk::Short, short>(env, object, iter->first, wantParams);
-        } else if (AAFwk::IInteger::Query(iter->second) != nullptr) {
-            InnerWrapJsWantParams<AAFwk::IInteger, AAFwk::Integer, int>(env, object, iter->first, wantParams);
-        } else if (AAFwk::ILong::Query(iter->second) != nullptr) {
-            InnerWrapJsWantParams<AAFwk::ILong, AAFwk::Long, int64_t>(env, object, iter->first, wantParams);
-        } else if (AAFwk::IFloat::Query(iter->second) != nullptr) {
-            InnerWrapJsWantParams<AAFwk::IFloat, AAFwk::Float, float>(env, object, iter->first, wantParams);
-        } else if (AAFwk::IDouble::Query(iter->second) != nullptr) {
-            InnerWrapJsWantParams<AAFwk::IDouble, AAFwk::Double, double>(env, object, iter->first, wantParams);
-        } else if (AAFwk::IChar::Query(iter->second) != nullptr) {
-            InnerWrapJsWantParams<AAFwk::IChar, AAFwk::Char, char>(env, object, iter->first, wantParams);
-        } else if (AAFwk::IByte::Query(iter->second) != nullptr) {
-            InnerWrapJsWantParams<AAFwk::IByte, AAFwk::Byte, int>(env, object, iter->first, wantParams);
-        } else if (AAFwk::IArray::Query(iter->second) != nullptr) {
-            AAFwk::IArray* ao = AAFwk::IArray::Query(iter->second);
-            if (ao != nullptr) {
-                sptr<AAFwk::IArray> array(ao);
-                WrapJsWantParamsArray(env, object, iter->first, array);
-            }
-        } else if (AAFwk::IWantParams::Query(iter->second) != nullptr) {
-            InnerWrapJsWantParamsWantParams(env, object, iter->first, wantParams);
+    // Visits the params in place, without copying them into a map first.
+    wantParams.ForEachParam([env, object, &wantParams](
+        const std::string& key, const sptr<AAFwk::IInterface>& value) {
+        if (AAFwk::IString::Query(value) != nullptr) {
+            InnerWrapJsWantParams<AAFwk::IString, AAFwk::String, std::string>(env, object, key, wantParams);
+        } else if (AAFwk::IBoolean::Query(value) != nullptr) {
+            InnerWrapJsWantParams<AAFwk::IBoolean, AAFwk::Boolean, bool>(env, object, key, wantParams);
+        } else if (AAFwk::IShort::Query(value) != nullptr) {
+            InnerWrapJsWantParams<AAFwk::IShort, AAFwk::Short, short>(env, object, key, wantParams);
+        } else if (AAFwk::IInteger::Query(value) != nullptr) {
+            InnerWrapJsWantParams<AAFwk::IInteger, AAFwk::Integer, int>(env, object, key, wantParams);
+        } else if (AAFwk::ILong::Query(value) != nullptr) {
+            InnerWrapJsWantParams<AAFwk::ILong, AAFwk::Long, int64_t>(env, object, key, wantParams);
+        } else if (AAFwk::IFloat::Query(value) != nullptr) {
+            InnerWrapJsWantParams<AAFwk::IFloat, AAFwk::Float, float>(env, object, key, wantParams);
+        } else if (AAFwk::IDouble::Query(value) != nullptr) {
+            InnerWrapJsWantParams<AAFwk::IDouble, AAFwk::Double, double>(env, object, key, wantParams);
+        } else if (AAFwk::IChar::Query(value) != nullptr) {
+            InnerWrapJsWantParams<AAFwk::IChar, AAFwk::Char, char>(env, object, key, wantParams);
+        } else if (AAFwk::IByte::Query(value) != nullptr) {
+            InnerWrapJsWantParams<AAFwk::IByte, AAFwk::Byte, int>(env, object, key, wantParams);
+        } else if (AAFwk::IArray::Query(value) != nullptr) {
+            sptr<AAFwk::IArray> array(AAFwk::IArray::Query(value));
+            WrapJsWantParamsArray(env, object, key, array);
+        } else if (AAFwk::IWantParams::Query(value) != nullptr) {
+            InnerWrapJsWantParamsWantParams(env, object, key, wantParams);
         }
-    }
+    });
     return object;
 }
 
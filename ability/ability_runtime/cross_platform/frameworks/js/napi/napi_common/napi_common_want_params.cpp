@@ -32,6 +32,8 @@
 namespace OHOS {
 namespace AppExecFwk {
 const int PROPERTIES_SIZE = 2;
+constexpr napi_property_attributes WANT_PARAMS_PROPERTY_ATTRIBUTES =
+    static_cast<napi_property_attributes>(napi_writable | napi_enumerable | napi_configurable);
 
 typedef struct __ComplexArrayData {
     std::vector<int> intList;
@@ -80,73 +82,19 @@ napi_value DoubleToJSValue(napi_env env, double value)
     return result;
 }
 
-napi_value ArrayStringToJSValue(napi_env env, const std::vector<std::string> &value)
+// Only unwrapping is bulk. Arrays are wrapped as plain JS Arrays, which N-API can only fill one element at a
+// time. Returning a TypedArray instead would change the type apps receive for every numeric array.
+template<typename T, typename F>
+napi_value ArrayToJSValue(napi_env env, const std::vector<T> &value, F createElement)
 {
     napi_value jsArray = nullptr;
-    napi_value jsValue = nullptr;
-    uint32_t index = 0;
-
-    NAPI_CALL(env, napi_create_array(env, &jsArray));
-    for (uint32_t i = 0; i < value.size(); i++) {
-        jsValue = nullptr;
-        if (napi_create_string_utf8(env, value[i].c_str(), NAPI_AUTO_LENGTH, &jsValue) == napi_ok) {
-            if (napi_set_element(env, jsArray, index, jsValue) == napi_ok) {
-                index++;
-            }
-        }
-    }
-    return jsArray;
-}
-
-napi_value ArrayBoolToJSValue(napi_env env, const std::vector<bool> &value)
-{
-    napi_value jsArray = nullptr;
-    napi_value jsValue = nullptr;
-    uint32_t index = 0;
-
-    NAPI_CALL(env, napi_create_array(env, &jsArray));
-    for (uint32_t i = 0; i < value.size(); i++) {
-        jsValue = nullptr;
-        if (napi_get_boolean(env, value[i], &jsValue) == napi_ok) {
-            if (napi_set_element(env, jsArray, index, jsValue) == napi_ok) {
-                index++;
-            }
-        }
-    }
-    return jsArray;
-}
-
-napi_value ArrayInt32ToJSValue(napi_env env, const std::vector<int> &value)
-{
-    napi_value jsArray = nullptr;
-    napi_value jsValue = nullptr;
-    uint32_t index = 0;
-
-    NAPI_CALL(env, napi_create_array(env, &jsArray));
-    for (uint32_t i = 0; i < value.size(); i++) {
-        jsValue = nullptr;
-        if (napi_create_int32(env, value[i], &jsValue) == napi_ok) {
-            if (napi_set_element(env, jsArray, index, jsValue) == napi_ok) {
-                index++;
-            }
-        }
-    }
-    return jsArray;
-}
-
-napi_value ArrayInt64ToJSValue(napi_env env, const std::vector<int64_t> &value)
-{
-    napi_value jsArray = nullptr;
-    napi_value jsValue = nullptr;
     uint32_t index = 0;
 
-    NAPI_CALL(env, napi_create_array(env, &jsArray));
-    for (uint32_t i = 0; i < value.size(); i++) {
-        jsValue = nullptr;
-        if (napi_create_int64(env, value[i], &jsValue) == napi_ok) {
-            if (napi_set_element(env, jsArray, index, jsValue) == napi_ok) {
-                index++;
-            }
+    NAPI_CALL(env, napi_create_array_with_length(env, value.size(), &jsArray));
+    for (size_t i = 0; i < value.size(); i++) {
+        napi_value jsValue = createElement(env, value[i]);
+        if (jsValue != nullptr && napi_set_element(env, jsArray, index, jsValue) == napi_ok) {
+            index++;
         }
     }
     return jsArray;
@@ -179,520 +127,95 @@ bool IsSameTypeForNapiValue(napi_env env, napi_value param, napi_valuetype expec
     return valueType == expectType;
 }
 
-bool InnerWrapWantParamsBool(
-    napi_env env, napi_value jsObject, const std::string &key, const AAFwk::WantParams &wantParams)
-{
-    auto value = wantParams.GetParam(key);
-    AAFwk::IBoolean *bo = AAFwk::IBoolean::Query(value);
-    if (bo == nullptr) {
-        return false;
-    }
-
-    bool natValue = AAFwk::Boolean::Unbox(bo);
-    napi_value jsValue = BoolToJSValue(env, natValue);
-    if (jsValue == nullptr) {
-        return false;
-    }
-
-    NAPI_CALL_BASE(env, napi_set_named_property(env, jsObject, key.c_str(), jsValue), false);
-    return true;
-}
-
-bool InnerWrapWantParamsShort(
-    napi_env env, napi_value jsObject, const std::string &key, const AAFwk::WantParams &wantParams)
-{
-    auto value = wantParams.GetParam(key);
-    AAFwk::IShort *ao = AAFwk::IShort::Query(value);
-    if (ao == nullptr) {
-        return false;
-    }
-
-    short natValue = AAFwk::Short::Unbox(ao);
-    napi_value jsValue = Int32ToJSValue(env, natValue);
-    if (jsValue == nullptr) {
-        return false;
-    }
-
-    NAPI_CALL_BASE(env, napi_set_named_property(env, jsObject, key.c_str(), jsValue), false);
-    return true;
-}
-
-bool InnerWrapWantParamsInt32(
-    napi_env env, napi_value jsObject, const std::string &key, const AAFwk::WantParams &wantParams)
-{
-    auto value = wantParams.GetParam(key);
-    AAFwk::IInteger *ao = AAFwk::IInteger::Query(value);
-    if (ao == nullptr) {
-        return false;
-    }
-
-    int natValue = AAFwk::Integer::Unbox(ao);
-    napi_value jsValue = Int32ToJSValue(env, natValue);
-    if (jsValue == nullptr) {
-        return false;
-    }
-
-    NAPI_CALL_BASE(env, napi_set_named_property(env, jsObject, key.c_str(), jsValue), false);
-    return true;
-}
-
-bool InnerWrapWantParamsInt64(
-    napi_env env, napi_value jsObject, const std::string &key, const AAFwk::WantParams &wantParams)
-{
-    auto value = wantParams.GetParam(key);
-    AAFwk::ILong *ao = AAFwk::ILong::Query(value);
-    if (ao == nullptr) {
-        return false;
-    }
-
-    int64_t natValue = AAFwk::Long::Unbox(ao);
-    napi_value jsValue = Int64ToJSValue(env, natValue);
-    if (jsValue == nullptr) {
-        return false;
-    }
-
-    NAPI_CALL_BASE(env, napi_set_named_property(env, jsObject, key.c_str(), jsValue), false);
-    return true;
-}
-
-bool InnerWrapWantParamsFloat(
-    napi_env env, napi_value jsObject, const std::string &key, const AAFwk::WantParams &wantParams)
-{
-    auto value = wantParams.GetParam(key);
-    AAFwk::IFloat *ao = AAFwk::IFloat::Query(value);
-    if (ao == nullptr) {
-        return false;
-    }
-
-    float natValue = AAFwk::Float::Unbox(ao);
-    napi_value jsValue = DoubleToJSValue(env, natValue);
-    if (jsValue == nullptr) {
-        return false;
-    }
-
-    NAPI_CALL_BASE(env, napi_set_named_property(env, jsObject, key.c_str(), jsValue), false);
-    return true;
-}
-
-bool InnerWrapWantParamsDouble(
-    napi_env env, napi_value jsObject, const std::string &key, const AAFwk::WantParams &wantParams)
-{
-    auto value = wantParams.GetParam(key);
-    AAFwk::IDouble *ao = AAFwk::IDouble::Query(value);
-    if (ao == nullptr) {
-        return false;
-    }
-
-    double natValue = AAFwk::Double::Unbox(ao);
-    napi_value jsValue = DoubleToJSValue(env, natValue);
-    if (jsValue == nullptr) {
-        return false;
-    }
-
-    NAPI_CALL_BASE(env, napi_set_named_property(env, jsObject, key.c_str(), jsValue), false);
-    return true;
-}
-
-bool InnerWrapWantParamsChar(
-    napi_env env, napi_value jsObject, const std::string &key, const AAFwk::WantParams &wantParams)
-{
-    auto value = wantParams.GetParam(key);
-    AAFwk::IChar *ao = AAFwk::IChar::Query(value);
-    if (ao == nullptr) {
-        return false;
-    }
-
-    std::string natValue(static_cast<AAFwk::Char *>(ao)->ToString());
-    napi_value jsValue = StringToJSValue(env, natValue);
-    if (jsValue == nullptr) {
-        return false;
-    }
-
-    NAPI_CALL_BASE(env, napi_set_named_property(env, jsObject, key.c_str(), jsValue), false);
-    return true;
-}
-
-bool InnerWrapWantParamsString(
-    napi_env env, napi_value jsObject, const std::string &key, const AAFwk::WantParams &wantParams)
+template<typename T, typename F>
+napi_value UnpackArrayToJSValue(napi_env env, AAFwk::IArray *ao, F createElement)
 {
-    auto value = wantParams.GetParam(key);
-    AAFwk::IString *ao = AAFwk::IString::Query(value);
-    if (ao == nullptr) {
-        return false;
-    }
-
-    std::string natValue = AAFwk::String::Unbox(ao);
-    napi_value jsValue = StringToJSValue(env, natValue);
-    if (jsValue == nullptr) {
-        return false;
-    }
-
-    NAPI_CALL_BASE(env, napi_set_named_property(env, jsObject, key.c_str(), jsValue), false);
-    return true;
-}
-
-bool InnerWrapWantParamsByte(
-    napi_env env, napi_value jsObject, const std::string &key, const AAFwk::WantParams &wantParams)
-{
-    auto value = wantParams.GetParam(key);
-    AAFwk::IByte *bo = AAFwk::IByte::Query(value);
-    if (bo == nullptr) {
-        return false;
+    std::vector<T> natArray;
+    if (!AAFwk::Array::Unpack(ao, natArray)) {
+        return nullptr;
     }
-
-    int intValue = (int)AAFwk::Byte::Unbox(bo);
-    napi_value jsValue = Int32ToJSValue(env, intValue);
-    if (jsValue == nullptr) {
-        return false;
-    }
-
-    NAPI_CALL_BASE(env, napi_set_named_property(env, jsObject, key.c_str(), jsValue), false);
-    return true;
+    return ArrayToJSValue(env, natArray, createElement);
 }
 
-bool InnerWrapWantParamsArrayString(napi_env env, napi_value jsObject, const std::string &key, sptr<AAFwk::IArray> &ao)
+napi_value ArrayCharToJSValue(napi_env env, AAFwk::IArray *ao)
 {
-    long size = 0;
-    if (ao->GetLength(size) != ERR_OK) {
-        return false;
-    }
-
     std::vector<std::string> natArray;
-    for (long i = 0; i < size; i++) {
-        sptr<AAFwk::IInterface> iface = nullptr;
-        if (ao->Get(i, iface) == ERR_OK) {
-            AAFwk::IString *iValue = AAFwk::IString::Query(iface);
-            if (iValue != nullptr) {
-                natArray.push_back(AAFwk::String::Unbox(iValue));
-            }
+    AAFwk::Array::ForEach(ao, [&natArray](AAFwk::IInterface *object) {
+        AAFwk::IChar *iValue = AAFwk::IChar::Query(object);
+        if (iValue != nullptr) {
+            natArray.push_back(static_cast<AAFwk::Char *>(iValue)->ToString());
         }
-    }
-
-    napi_value jsValue = ArrayStringToJSValue(env, natArray);
-    if (jsValue != nullptr) {
-        NAPI_CALL_BASE(env, napi_set_named_property(env, jsObject, key.c_str(), jsValue), false);
-        return true;
-    }
-    return false;
-}
-
-bool InnerWrapWantParamsArrayBool(napi_env env, napi_value jsObject, const std::string &key, sptr<AAFwk::IArray> &ao)
-{
-    long size = 0;
-    if (ao->GetLength(size) != ERR_OK) {
-        return false;
-    }
-
-    std::vector<bool> natArray;
-    for (long i = 0; i < size; i++) {
-        sptr<AAFwk::IInterface> iface = nullptr;
-        if (ao->Get(i, iface) == ERR_OK) {
-            AAFwk::IBoolean *iValue = AAFwk::IBoolean::Query(iface);
-            if (iValue != nullptr) {
-                natArray.push_back(AAFwk::Boolean::Unbox(iValue));
-            }
-        }
-    }
-
-    napi_value jsValue = ArrayBoolToJSValue(env, natArray);
-    if (jsValue != nullptr) {
-        NAPI_CALL_BASE(env, napi_set_named_property(env, jsObject, key.c_str(), jsValue), false);
-        return true;
-    }
-    return false;
+    });
+    return ArrayToJSValue(env, natArray, StringToJSValue);
 }
 
-bool InnerWrapWantParamsArrayShort(napi_env env, napi_value jsObject, const std::string &key, sptr<AAFwk::IArray> &ao)
+napi_value ArrayWantParamsToJSValue(napi_env env, AAFwk::IArray *ao)
 {
-    long size = 0;
-    if (ao->GetLength(size) != ERR_OK) {
-        return false;
-    }
-
-    std::vector<int> natArray;
-    for (long i = 0; i < size; i++) {
-        sptr<AAFwk::IInterface> iface = nullptr;
-        if (ao->Get(i, iface) == ERR_OK) {
-            AAFwk::IShort *iValue = AAFwk::IShort::Query(iface);
-            if (iValue != nullptr) {
-                natArray.push_back(AAFwk::Short::Unbox(iValue));
-            }
-        }
-    }
-
-    napi_value jsValue = ArrayInt32ToJSValue(env, natArray);
-    if (jsValue != nullptr) {
-        NAPI_CALL_BASE(env, napi_set_named_property(env, jsObject, key.c_str(), jsValue), false);
-        return true;
-    }
-    return false;
-}
-
-bool InnerWrapWantParamsArrayInt32(napi_env env, napi_value jsObject, const std::string &key, sptr<AAFwk::IArray> &ao)
-{
-    long size = 0;
-    if (ao->GetLength(size) != ERR_OK) {
-        return false;
-    }
-
-    std::vector<int> natArray;
-    for (long i = 0; i < size; i++) {
-        sptr<AAFwk::IInterface> iface = nullptr;
-        if (ao->Get(i, iface) == ERR_OK) {
-            AAFwk::IInteger *iValue = AAFwk::IInteger::Query(iface);
-            if (iValue != nullptr) {
-                natArray.push_back(AAFwk::Integer::Unbox(iValue));
-            }
-        }
-    }
-
-    napi_value jsValue = ArrayInt32ToJSValue(env, natArray);
-    if (jsValue != nullptr) {
-        NAPI_CALL_BASE(env, napi_set_named_property(env, jsObject, key.c_str(), jsValue), false);
-        return true;
-    }
-    return false;
-}
-
-bool InnerWrapWantParamsArrayInt64(napi_env env, napi_value jsObject, const std::string &key, sptr<AAFwk::IArray> &ao)
-{
-    long size = 0;
-    if (ao->GetLength(size) != ERR_OK) {
-        return false;
-    }
-
-    std::vector<int64_t> natArray;
-    for (long i = 0; i < size; i++) {
-        sptr<AAFwk::IInterface> iface = nullptr;
-        if (ao->Get(i, iface) == ERR_OK) {
-            AAFwk::ILong *iValue = AAFwk::ILong::Query(iface);
-            if (iValue != nullptr) {
-                natArray.push_back(AAFwk::Long::Unbox(iValue));
-            }
-        }
-    }
-
-    napi_value jsValue = ArrayInt64ToJSValue(env, natArray);
-    if (jsValue != nullptr) {
-        NAPI_CALL_BASE(env, napi_set_named_property(env, jsObject, key.c_str(), jsValue), false);
-        return true;
-    }
-    return false;
-}
-
-napi_value ArrayDoubleToJSValue(napi_env env, const std::vector<double> &value)
-{
-    napi_value jsArray = nullptr;
-    napi_value jsValue = nullptr;
-    uint32_t index = 0;
-
-    NAPI_CALL(env, napi_create_array(env, &jsArray));
-    for (uint32_t i = 0; i < value.size(); i++) {
-        jsValue = nullptr;
-        if (napi_create_double(env, value[i], &jsValue) == napi_ok) {
-            if (napi_set_element(env, jsArray, index, jsValue) == napi_ok) {
-                index++;
-            }
-        }
-    }
-    return jsArray;
-}
-
-napi_value ArrayWantParamsToJSValue(napi_env env, const std::vector<AAFwk::WantParams> &value)
-{
-    napi_value jsArray = nullptr;
-    napi_value jsValue = nullptr;
-    uint32_t index = 0;
-
-    NAPI_CALL(env, napi_create_array(env, &jsArray));
-    for (uint32_t i = 0; i < value.size(); i++) {
-        jsValue = WrapWantParams(env, value[i]);
-        if (jsValue != nullptr) {
-            if (napi_set_element(env, jsArray, index, jsValue) == napi_ok) {
-                index++;
-            }
-        }
-    }
-    return jsArray;
-}
-
-bool InnerWrapWantParamsArrayFloat(napi_env env, napi_value jsObject, const std::string &key, sptr<AAFwk::IArray> &ao)
-{
-    long size = 0;
-    if (ao->GetLength(size) != ERR_OK) {
-        return false;
-    }
-
-    std::vector<double> natArray;
-    for (long i = 0; i < size; i++) {
-        sptr<AAFwk::IInterface> iface = nullptr;
-        if (ao->Get(i, iface) == ERR_OK) {
-            AAFwk::IFloat *iValue = AAFwk::IFloat::Query(iface);
-            if (iValue != nullptr) {
-                natArray.push_back(AAFwk::Float::Unbox(iValue));
-            }
-        }
-    }
-
-    napi_value jsValue = ArrayDoubleToJSValue(env, natArray);
-    if (jsValue != nullptr) {
-        NAPI_CALL_BASE(env, napi_set_named_property(env, jsObject, key.c_str(), jsValue), false);
-        return true;
-    }
-    return false;
-}
-
-bool InnerWrapWantParamsArrayByte(napi_env env, napi_value jsObject, const std::string &key, sptr<AAFwk::IArray> &ao)
-{
-    long size = 0;
-    if (ao->GetLength(size) != ERR_OK) {
-        return false;
-    }
-
-    std::vector<int> natArray;
-    for (long i = 0; i < size; i++) {
-        sptr<AAFwk::IInterface> iface = nullptr;
-        if (ao->Get(i, iface) == ERR_OK) {
-            AAFwk::IByte *iValue = AAFwk::IByte::Query(iface);
-            if (iValue != nullptr) {
-                int intValue = (int)AAFwk::Byte::Unbox(iValue);
-                natArray.push_back(intValue);
-            }
-        }
-    }
-
-    napi_value jsValue = ArrayInt32ToJSValue(env, natArray);
-    if (jsValue != nullptr) {
-        NAPI_CALL_BASE(env, napi_set_named_property(env, jsObject, key.c_str(), jsValue), false);
-        return true;
-    }
-    return false;
-}
-
-bool InnerWrapWantParamsArrayChar(napi_env env, napi_value jsObject, const std::string &key, sptr<AAFwk::IArray> &ao)
-{
-    long size = 0;
-    if (ao->GetLength(size) != ERR_OK) {
-        return false;
-    }
-
-    std::vector<std::string> natArray;
-    for (long i = 0; i < size; i++) {
-        sptr<AAFwk::IInterface> iface = nullptr;
-        if (ao->Get(i, iface) == ERR_OK) {
-            AAFwk::IChar *iValue = AAFwk::IChar::Query(iface);
-            if (iValue != nullptr) {
-                std::string str(static_cast<AAFwk::Char *>(iValue)->ToString());
-                natArray.push_back(str);
-            }
-        }
-    }
-
-    napi_value jsValue = ArrayStringToJSValue(env, natArray);
-    if (jsValue != nullptr) {
-        NAPI_CALL_BASE(env, napi_set_named_property(env, jsObject, key.c_str(), jsValue), false);
-        return true;
-    }
-    return false;
-}
-
-bool InnerWrapWantParamsArrayDouble(napi_env env, napi_value jsObject, const std::string &key, sptr<AAFwk::IArray> &ao)
-{
-    long size = 0;
-    if (ao->GetLength(size) != ERR_OK) {
-        return false;
-    }
-
-    std::vector<double> natArray;
-    for (long i = 0; i < size; i++) {
-        sptr<AAFwk::IInterface> iface = nullptr;
-        if (ao->Get(i, iface) == ERR_OK) {
-            AAFwk::IDouble *iValue = AAFwk::IDouble::Query(iface);
-            if (iValue != nullptr) {
-                natArray.push_back(AAFwk::Double::Unbox(iValue));
-            }
-        }
-    }
-
-    napi_value jsValue = ArrayDoubleToJSValue(env, natArray);
-    if (jsValue != nullptr) {
-        NAPI_CALL_BASE(env, napi_set_named_property(env, jsObject, key.c_str(), jsValue), false);
-        return true;
-    }
-    return false;
-}
-
-bool InnerWrapWantParamsArrayWantParams(napi_env env, napi_value jsObject,
-    const std::string &key, sptr<AAFwk::IArray> &ao)
-{
-    long size = 0;
-    if (ao->GetLength(size) != ERR_OK) {
-        return false;
-    }
-
     std::vector<AAFwk::WantParams> natArray;
-    for (long i = 0; i < size; i++) {
-        sptr<AAFwk::IInterface> iface = nullptr;
-        if (ao->Get(i, iface) == ERR_OK) {
-            AAFwk::IWantParams *iValue = AAFwk::IWantParams::Query(iface);
-            if (iValue != nullptr) {
-                natArray.push_back(AAFwk::WantParamWrapper::Unbox(iValue));
-            }
+    AAFwk::Array::ForEach(ao, [&natArray](AAFwk::IInterface *object) {
+        AAFwk::IWantParams *iValue = AAFwk::IWantParams::Query(object);
+        if (iValue != nullptr) {
+            natArray.push_back(AAFwk::WantParamWrapper::Unbox(iValue));
         }
-    }
-
-    napi_value jsValue = ArrayWantParamsToJSValue(env, natArray);
-    if (jsValue != nullptr) {
-        NAPI_CALL_BASE(env, napi_set_named_property(env, jsObject, key.c_str(), jsValue), false);
-        return true;
-    }
-    return false;
+    });
+    return ArrayToJSValue(env, natArray, WrapWantParams);
 }
 
-bool InnerWrapWantParamsArray(napi_env env, napi_value jsObject, const std::string &key, sptr<AAFwk::IArray> &ao)
+napi_value WrapWantParamsArray(napi_env env, AAFwk::IArray *ao)
 {
+    // Arrays of primitives are copied out of their unboxed storage in one go.
     if (AAFwk::Array::IsStringArray(ao)) {
-        return InnerWrapWantParamsArrayString(env, jsObject, key, ao);
+        return UnpackArrayToJSValue<std::string>(env, ao, StringToJSValue);
     } else if (AAFwk::Array::IsBooleanArray(ao)) {
-        return InnerWrapWantParamsArrayBool(env, jsObject, key, ao);
+        return UnpackArrayToJSValue<bool>(env, ao, BoolToJSValue);
     } else if (AAFwk::Array::IsShortArray(ao)) {
-        return InnerWrapWantParamsArrayShort(env, jsObject, key, ao);
+        return UnpackArrayToJSValue<short>(env, ao, Int32ToJSValue);
     } else if (AAFwk::Array::IsIntegerArray(ao)) {
-        return InnerWrapWantParamsArrayInt32(env, jsObject, key, ao);
+        return UnpackArrayToJSValue<int>(env, ao, Int32ToJSValue);
     } else if (AAFwk::Array::IsLongArray(ao)) {
-        return InnerWrapWantParamsArrayInt64(env, jsObject, key, ao);
+        return UnpackArrayToJSValue<long>(env, ao, Int64ToJSValue);
     } else if (AAFwk::Array::IsFloatArray(ao)) {
-        return InnerWrapWantParamsArrayFloat(env, jsObject, key, ao);
+        return UnpackArrayToJSValue<float>(env, ao, DoubleToJSValue);
     } else if (AAFwk::Array::IsByteArray(ao)) {
-        return InnerWrapWantParamsArrayByte(env, jsObject, key, ao);
+        return UnpackArrayToJSValue<AAFwk::byte>(env, ao, Int32ToJSValue);
     } else if (AAFwk::Array::IsCharArray(ao)) {
-        return InnerWrapWantParamsArrayChar(env, jsObject, key, ao);
+        return ArrayCharToJSValue(env, ao);
     } else if (AAFwk::Array::IsDoubleArray(ao)) {
-        return InnerWrapWantParamsArrayDouble(env, jsObject, key, ao);
+        return UnpackArrayToJSValue<double>(env, ao, DoubleToJSValue);
     } else if (AAFwk::Array::IsWantParamsArray(ao)) {
-        return InnerWrapWantParamsArrayWantParams(env, jsObject, key, ao);
+        return ArrayWantParamsToJSValue(env, ao);
     } else {
-        return false;
-    }
-}
-
-bool InnerWrapWantParamsWantParams(
-    napi_env env, napi_value jsObject, const std::string &key, const AAFwk::WantParams &wantParams)
-{
-    auto value = wantParams.GetParam(key);
-    AAFwk::IWantParams *o = AAFwk::IWantParams::Query(value);
-    if (o == nullptr) {
-        return false;
-    }
-
-    AAFwk::WantParams wp = AAFwk::WantParamWrapper::Unbox(o);
-    napi_value jsValue = WrapWantParams(env, wp);
-    if (jsValue == nullptr) {
-        return false;
+        return nullptr;
+    }
+}
+
+napi_value WrapWantParamsValue(napi_env env, const sptr<AAFwk::IInterface> &value)
+{
+    if (AAFwk::IString::Query(value) != nullptr) {
+        return StringToJSValue(env, AAFwk::String::Unbox(AAFwk::IString::Query(value)));
+    } else if (AAFwk::IBoolean::Query(value) != nullptr) {
+        return BoolToJSValue(env, AAFwk::Boolean::Unbox(AAFwk::IBoolean::Query(value)));
+    } else if (AAFwk::IShort::Query(value) != nullptr) {
+        return Int32ToJSValue(env, AAFwk::Short::Unbox(AAFwk::IShort::Query(value)));
+    } else if (AAFwk::IInteger::Query(value) != nullptr) {
+        return Int32ToJSValue(env, AAFwk::Integer::Unbox(AAFwk::IInteger::Query(value)));
+    } else if (AAFwk::ILong::Query(value) != nullptr) {
+        return Int64ToJSValue(env, AAFwk::Long::Unbox(AAFwk::ILong::Query(value)));
+    } else if (AAFwk::IFloat::Query(value) != nullptr) {
+        return DoubleToJSValue(env, AAFwk::Float::Unbox(AAFwk::IFloat::Query(value)));
+    } else if (AAFwk::IDouble::Query(value) != nullptr) {
+        return DoubleToJSValue(env, AAFwk::Double::Unbox(AAFwk::IDouble::Query(value)));
+    } else if (AAFwk::IChar::Query(value) != nullptr) {
+        return StringToJSValue(env, static_cast<AAFwk::Char *>(AAFwk::IChar::Query(value))->ToString());
+    } else if (AAFwk::IByte::Query(value) != nullptr) {
+        return Int32ToJSValue(env, AAFwk::Byte::Unbox(AAFwk::IByte::Query(value)));
+    } else if (AAFwk::IArray::Query(value) != nullptr) {
+        return WrapWantParamsArray(env, AAFwk::IArray::Query(value));
+    } else if (AAFwk::IWantParams::Query(value) != nullptr) {
+        return WrapWantParams(env, AAFwk::WantParamWrapper::Unbox(AAFwk::IWantParams::Query(value)));
+    } else {
+        return nullptr;
     }
-
-    NAPI_CALL_BASE(env, napi_set_named_property(env, jsObject, key.c_str(), jsValue), false);
-    return true;
 }
 
 void InnerUnwrapWantParamsNumber(napi_env env, const std::string &key, napi_value param, AAFwk::WantParams &wantParams)
@@ -892,80 +415,47 @@ bool InnerSetWantParamsArrayObject(napi_env env, const std::string &key,
     }
 }
 
-bool InnerSetWantParamsArrayString(
-    const std::string &key, const std::vector<std::string> &value, AAFwk::WantParams &wantParams)
-{
-    size_t size = value.size();
-    sptr<AAFwk::IArray> ao = new (std::nothrow) AAFwk::Array(size, AAFwk::g_IID_IString);
-    if (ao != nullptr) {
-        for (size_t i = 0; i < size; i++) {
-            ao->Set(i, AAFwk::String::Box(value[i]));
-        }
-        wantParams.SetParam(key, ao);
-        return true;
-    } else {
-        return false;
-    }
-}
-
-bool InnerSetWantParamsArrayInt(const std::string &key, const std::vector<int> &value, AAFwk::WantParams &wantParams)
-{
-    size_t size = value.size();
-    sptr<AAFwk::IArray> ao = new (std::nothrow) AAFwk::Array(size, AAFwk::g_IID_IInteger);
-    if (ao != nullptr) {
-        for (size_t i = 0; i < size; i++) {
-            ao->Set(i, AAFwk::Integer::Box(value[i]));
-        }
-        wantParams.SetParam(key, ao);
-        return true;
-    } else {
-        return false;
-    }
-}
-
-bool InnerSetWantParamsArrayLong(const std::string &key, const std::vector<long> &value, AAFwk::WantParams &wantParams)
+template<typename From, typename To>
+bool InnerSetWantParamsTypedArray(
+    const std::string &key, const void *data, size_t length, AAFwk::WantParams &wantParams)
 {
-    size_t size = value.size();
-    sptr<AAFwk::IArray> ao = new (std::nothrow) AAFwk::Array(size, AAFwk::g_IID_ILong);
-    if (ao != nullptr) {
-        for (size_t i = 0; i < size; i++) {
-            ao->Set(i, AAFwk::Long::Box(value[i]));
-        }
-        wantParams.SetParam(key, ao);
-        return true;
-    } else {
-        return false;
-    }
+    const From *begin = static_cast<const From *>(data);
+    wantParams.SetArrayParam(key, std::vector<To>(begin, begin + length));
+    return true;
 }
 
-bool InnerSetWantParamsArrayBool(const std::string &key, const std::vector<bool> &value, AAFwk::WantParams &wantParams)
+bool InnerUnwrapWantParamsTypedArray(
+    napi_env env, const std::string &key, napi_value param, AAFwk::WantParams &wantParams)
 {
-    size_t size = value.size();
-    sptr<AAFwk::IArray> ao = new (std::nothrow) AAFwk::Array(size, AAFwk::g_IID_IBoolean);
-    if (ao != nullptr) {
-        for (size_t i = 0; i < size; i++) {
-            ao->Set(i, AAFwk::Boolean::Box(value[i]));
-        }
-        wantParams.SetParam(key, ao);
-        return true;
-    } else {
+    napi_typedarray_type type = napi_int8_array;
+    size_t length = 0;
+    void *data = nullptr;
+    NAPI_CALL_BASE(env, napi_get_typedarray_info(env, param, &type, &length, &data, nullptr, nullptr), false);
+    if (length == 0 || data == nullptr) {
         return false;
     }
-}
 
-bool InnerSetWantParamsArrayDouble(
-    const std::string &key, const std::vector<double> &value, AAFwk::WantParams &wantParams)
-{
-    size_t size = value.size();
-    sptr<AAFwk::IArray> ao = new (std::nothrow) AAFwk::Array(size, AAFwk::g_IID_IDouble);
-    if (ao != nullptr) {
-        for (size_t i = 0; i < size; i++) {
-            ao->Set(i, AAFwk::Double::Box(value[i]));
-        }
-        wantParams.SetParam(key, ao);
-        return true;
-    } else {
-        return false;
+    // The backing store is copied in a single pass, elements of the same width are copied as a block.
+    switch (type) {
+        case napi_int8_array:
+            return InnerSetWantParamsTypedArray<int8_t, int>(key, data, length, wantParams);
+        case napi_uint8_array:
+        case napi_uint8_clamped_array:
+            return InnerSetWantParamsTypedArray<uint8_t, int>(key, data, length, wantParams);
+        case napi_int16_array:
+            return InnerSetWantParamsTypedArray<int16_t, int>(key, data, length, wantParams);
+        case napi_uint16_array:
+            return InnerSetWantParamsTypedArray<uint16_t, int>(key, data, length, wantParams);
+        case napi_int32_array:
+            return InnerSetWantParamsTypedArray<int32_t, int>(key, data, length, wantParams);
+        case napi_uint32_array:
+            return InnerSetWantParamsTypedArray<uint32_t, long>(key, data, length, wantParams);
+        case napi_float32_array:
+            return InnerSetWantParamsTypedArray<float, double>(key, data, length, wantParams);
+        case napi_float64_array:
+            return InnerSetWantParamsTypedArray<double, double>(key, data, length, wantParams);
+        default:
+            return false;
     }
 }
 
@@ -978,20 +468,27 @@ bool InnerUnwrapWantParamsArray(napi_env env, const std::string &key, napi_value
     if (natArrayValue.objectList.size() > 0) {
         return InnerSetWantParamsArrayObject(env, key, natArrayValue.objectList, wantParams);
     }
+
+    // Primitive elements are stored unboxed, the collected list is handed over as is.
     if (natArrayValue.stringList.size() > 0) {
-        return InnerSetWantParamsArrayString(key, natArrayValue.stringList, wantParams);
+        wantParams.SetArrayParam(key, std::move(natArrayValue.stringList));
+        return true;
     }
     if (natArrayValue.intList.size() > 0) {
-        return InnerSetWantParamsArrayInt(key, natArrayValue.intList, wantParams);
+        wantParams.SetArrayParam(key, std::move(natArrayValue.intList));
+        return true;
     }
     if (natArrayValue.longList.size() > 0) {
-        return InnerSetWantParamsArrayLong(key, natArrayValue.longList, wantParams);
+        wantParams.SetArrayParam(key, std::move(natArrayValue.longList));
+        return true;
     }
     if (natArrayValue.boolList.size() > 0) {
-        return InnerSetWantParamsArrayBool(key, natArrayValue.boolList, wantParams);
+        wantParams.SetArrayParam(key, std::move(natArrayValue.boolList));
+        return true;
     }
     if (natArrayValue.doubleList.size() > 0) {
-        return InnerSetWantParamsArrayDouble(key, natArrayValue.doubleList, wantParams);
+        wantParams.SetArrayParam(key, std::move(natArrayValue.doubleList));
+        return true;
     }
 
     return false;
@@ -1010,12 +507,9 @@ bool InnerUnwrapWantParams(napi_env env, const std::string &key, napi_value para
     return false;
 }
 
-bool IsSpecialObject(napi_env env, napi_value param, std::string &strProName, const std::string &type,
+bool IsSpecialObject(napi_env env, napi_value jsWantParamProValue, const std::string &type,
     napi_valuetype jsValueProType)
 {
-    napi_value jsWantParamProValue = nullptr;
-    NAPI_CALL_BASE(env, napi_get_named_property(env, param, strProName.c_str(), &jsWantParamProValue), false);
-
     napi_valuetype jsValueType = napi_undefined;
     napi_value jsProValue = nullptr;
     NAPI_CALL_BASE(env, napi_get_named_property(env, jsWantParamProValue, AAFwk::TYPE_PROPERTY, &jsProValue), false);
@@ -1045,10 +539,9 @@ bool IsSpecialObject(napi_env env, napi_value param, std::string &strProName, co
     return (jsValueType == jsValueProType);
 }
 
-bool HandleFdObject(napi_env env, napi_value param, std::string &strProName, AAFwk::WantParams &wantParams)
+bool HandleFdObject(napi_env env, napi_value jsWantParamProValue, std::string &strProName,
+    AAFwk::WantParams &wantParams)
 {
-    napi_value jsWantParamProValue = nullptr;
-    NAPI_CALL_BASE(env, napi_get_named_property(env, param, strProName.c_str(), &jsWantParamProValue), false);
     napi_value jsProValue = nullptr;
     NAPI_CALL_BASE(env, napi_get_named_property(env, jsWantParamProValue, AAFwk::VALUE_PROPERTY, &jsProValue),
         false);
@@ -1063,21 +556,29 @@ bool HandleFdObject(napi_env env, napi_value param, std::string &strProName, AAF
     return true;
 }
 
-void HandleNapiObject(napi_env env, napi_value param, napi_value jsProValue, std::string &strProName,
-    AAFwk::WantParams &wantParams)
+void HandleNapiObject(napi_env env, napi_value jsProValue, std::string &strProName, AAFwk::WantParams &wantParams)
 {
-    if (IsSpecialObject(env, param, strProName, AAFwk::FD, napi_number)) {
-        HandleFdObject(env, param, strProName, wantParams);
-    } else if (IsSpecialObject(env, param, strProName, "RemoteObject", napi_object)) {
+    if (IsSpecialObject(env, jsProValue, AAFwk::FD, napi_number)) {
+        HandleFdObject(env, jsProValue, strProName, wantParams);
+    } else if (IsSpecialObject(env, jsProValue, "RemoteObject", napi_object)) {
     } else {
         bool isArray = false;
-        if (napi_is_array(env, jsProValue, &isArray) == napi_ok) {
-            if (isArray) {
-                InnerUnwrapWantParamsArray(env, strProName, jsProValue, wantParams);
-            } else {
-                InnerUnwrapWantParams(env, strProName, jsProValue, wantParams);
-            }
+        if (napi_is_array(env, jsProValue, &isArray) != napi_ok) {
+            return;
+        }
+        if (isArray) {
+            InnerUnwrapWantParamsArray(env, strProName, jsProValue, wantParams);
+            return;
         }
+        // A non-empty typed array of up to 32-bit elements is stored as an int, long or double array and comes
+        // back to JS as a plain Array. It used to be stored as a WantParams keyed by index and came back as an
+        // object. Empty typed arrays and those of 64-bit integers still take that object path.
+        bool isTypedArray = false;
+        if (napi_is_typedarray(env, jsProValue, &isTypedArray) == napi_ok && isTypedArray &&
+            InnerUnwrapWantParamsTypedArray(env, strProName, jsProValue, wantParams)) {
+            return;
+        }
+        InnerUnwrapWantParams(env, strProName, jsProValue, wantParams);
     }
 }
 
@@ -1086,35 +587,24 @@ napi_value WrapWantParams(napi_env env, const AAFwk::WantParams& wantParams)
     napi_value jsObject = nullptr;
     NAPI_CALL(env, napi_create_object(env, &jsObject));
 
-    const std::map<std::string, sptr<AAFwk::IInterface>> paramList = wantParams.GetParams();
-    for (auto iter = paramList.begin(); iter != paramList.end(); iter++) {
-        if (AAFwk::IString::Query(iter->second) != nullptr) {
-            InnerWrapWantParamsString(env, jsObject, iter->first, wantParams);
-        } else if (AAFwk::IBoolean::Query(iter->second) != nullptr) {
-            InnerWrapWantParamsBool(env, jsObject, iter->first, wantParams);
-        } else if (AAFwk::IShort::Query(iter->second) != nullptr) {
-            InnerWrapWantParamsShort(env, jsObject, iter->first, wantParams);
-        } else if (AAFwk::IInteger::Query(iter->second) != nullptr) {
-            InnerWrapWantParamsInt32(env, jsObject, iter->first, wantParams);
-        } else if (AAFwk::ILong::Query(iter->second) != nullptr) {
-            InnerWrapWantParamsInt64(env, jsObject, iter->first, wantParams);
-        } else if (AAFwk::IFloat::Query(iter->second) != nullptr) {
-            InnerWrapWantParamsFloat(env, jsObject, iter->first, wantParams);
-        } else if (AAFwk::IDouble::Query(iter->second) != nullptr) {
-            InnerWrapWantParamsDouble(env, jsObject, iter->first, wantParams);
-        } else if (AAFwk::IChar::Query(iter->second) != nullptr) {
-            InnerWrapWantParamsChar(env, jsObject, iter->first, wantParams);
-        } else if (AAFwk::IByte::Query(iter->second) != nullptr) {
-            InnerWrapWantParamsByte(env, jsObject, iter->first, wantParams);
-        } else if (AAFwk::IArray::Query(iter->second) != nullptr) {
-            AAFwk::IArray *ao = AAFwk::IArray::Query(iter->second);
-            if (ao != nullptr) {
-                sptr<AAFwk::IArray> array(ao);
-                InnerWrapWantParamsArray(env, jsObject, iter->first, array);
-            }
-        } else if (AAFwk::IWantParams::Query(iter->second) != nullptr) {
-            InnerWrapWantParamsWantParams(env, jsObject, iter->first, wantParams);
+    // Convert all values first, then define every property of the object with a single call.
+    std::vector<napi_property_descriptor> descriptors;
+    descriptors.reserve(wantParams.Size());
+    wantParams.ForEachParam([env, &descriptors](
+        const std::string& key, const sptr<AAFwk::IInterface>& value) {
+        napi_value jsValue = WrapWantParamsValue(env, value);
+        if (jsValue == nullptr) {
+            return;
         }
+        napi_property_descriptor descriptor = {};
+        // The key is owned by wantParams, which outlives the napi_define_properties call below.
+        descriptor.utf8name = key.c_str();
+        descriptor.value = jsValue;
+        descriptor.attributes = WANT_PARAMS_PROPERTY_ATTRIBUTES;
+        descriptors.push_back(descriptor);
+    });
+    if (!descriptors.empty()) {
+        NAPI_CALL_BASE(env, napi_define_properties(env, jsObject, descriptors.size(), descriptors.data()), jsObject);
     }
     return jsObject;
 }
@@ -1139,7 +629,7 @@ bool UnwrapWantParams(napi_env env, napi_value param, AAFwk::WantParams& wantPar
 
         std::string strProName = GetStringWithDefaultFromJSValue(env, jsProName, std::string(""));
 
-        NAPI_CALL_BASE(env, napi_get_named_property(env, param, strProName.c_str(), &jsProValue), false);
+        NAPI_CALL_BASE(env, napi_get_property(env, param, jsProName, &jsProValue), false);
         NAPI_CALL_BASE(env, napi_typeof(env, jsProValue, &jsValueType), false);
 
         switch (jsValueType) {
@@ -1159,7 +649,7 @@ bool UnwrapWantParams(napi_env env, napi_value param, AAFwk::WantParams& wantPar
                 break;
             }
             case napi_object: {
-                HandleNapiObject(env, param, jsProValue, strProName, wantParams);
+                HandleNapiObject(env, jsProValue, strProName, wantParams);
                 break;
             }
             default:
@@ -57,7 +57,10 @@ void Ability::Init(const std::shared_ptr<AppExecFwk::AbilityInfo>& abilityInfo)
 void Ability::OnCreate(const Want& want)
 {
     HILOG_INFO("OnCreate begin.");
-    SetWant(want);
+    // The launch path hands over its Want through SetWant() and passes the stored one here.
+    if (want_ == nullptr || want_.get() != &want) {
+        SetWant(want);
+    }
 
     if (abilityLifecycleExecutor_ == nullptr) {
         HILOG_ERROR("Ability::OnStart error. abilityLifecycleExecutor_ == nullptr.");
@@ -139,6 +142,11 @@ void Ability::SetWant(const AAFwk::Want& want)
     want_ = std::make_shared<AAFwk::Want>(want);
 }
 
+void Ability::SetWant(AAFwk::Want&& want)
+{
+    want_ = std::make_shared<AAFwk::Want>(std::move(want));
+}
+
 std::shared_ptr<AAFwk::Want> Ability::GetWant()
 {
     return want_;
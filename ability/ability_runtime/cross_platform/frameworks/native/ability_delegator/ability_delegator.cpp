@@ -41,15 +41,17 @@ void AbilityDelegator::AddAbilityMonitor(const std::shared_ptr<IAbilityMonitor>
     }
 
     std::unique_lock<std::mutex> lck(mutexMonitor_);
-    auto pos = std::find(abilityMonitors_.begin(), abilityMonitors_.end(), monitor);
-    if (pos != abilityMonitors_.end()) {
+    auto &monitors = abilityMonitors_[monitor->GetAbilityName()];
+    auto pos = std::find(monitors.begin(), monitors.end(), monitor);
+    if (pos != monitors.end()) {
         HILOG_WARN("Monitor has been added");
         return;
     }
 
-    HILOG_DEBUG("before AddAbilityMonitor count: %{public}zu", abilityMonitors_.size());
-    abilityMonitors_.emplace_back(monitor);
-    HILOG_DEBUG("after AddAbilityMonitor count: %{public}zu", abilityMonitors_.size());
+    HILOG_DEBUG("before AddAbilityMonitor count: %{public}zu", abilityMonitorsNum_);
+    monitors.emplace_back(monitor);
+    ++abilityMonitorsNum_;
+    HILOG_DEBUG("after AddAbilityMonitor count: %{public}zu", abilityMonitorsNum_);
 }
 
 void AbilityDelegator::AddAbilityStageMonitor(const std::shared_ptr<IAbilityStageMonitor> &monitor)
@@ -59,17 +61,19 @@ void AbilityDelegator::AddAbilityStageMonitor(const std::shared_ptr<IAbilityStag
         HILOG_ERROR("Invalid input parameter");
         return;
     }
-	
+
     std::unique_lock<std::mutex> lck(mutexStageMonitor_);
-    auto pos = std::find(abilityStageMonitors_.begin(), abilityStageMonitors_.end(), monitor);
-    if (pos != abilityStageMonitors_.end()) {
+    auto &monitors = abilityStageMonitors_[monitor->GetModuleName()];
+    auto pos = std::find(monitors.begin(), monitors.end(), monitor);
+    if (pos != monitors.end()) {
         HILOG_WARN("Stage monitor has been added");
         return;
     }
 
-    HILOG_DEBUG("before AddAbilityStageMonitor count: %{public}zu", abilityStageMonitors_.size());
-    abilityStageMonitors_.emplace_back(monitor);
-    HILOG_DEBUG("after AddAbilityStageMonitor count: %{public}zu", abilityStageMonitors_.size());
+    HILOG_DEBUG("before AddAbilityStageMonitor count: %{public}zu", abilityStageMonitorsNum_);
+    monitors.emplace_back(monitor);
+    ++abilityStageMonitorsNum_;
+    HILOG_DEBUG("after AddAbilityStageMonitor count: %{public}zu", abilityStageMonitorsNum_);
 }
 
 void AbilityDelegator::RemoveAbilityMonitor(const std::shared_ptr<IAbilityMonitor> &monitor)
@@ -81,12 +85,20 @@ void AbilityDelegator::RemoveAbilityMonitor(const std::shared_ptr<IAbilityMonito
     }
 
     std::unique_lock<std::mutex> lck(mutexMonitor_);
-    auto pos = std::find(abilityMonitors_.begin(), abilityMonitors_.end(), monitor);
-    if (pos != abilityMonitors_.end()) {
-        abilityMonitors_.erase(pos);
+    auto iter = abilityMonitors_.find(monitor->GetAbilityName());
+    if (iter != abilityMonitors_.end()) {
+        auto &monitors = iter->second;
+        auto pos = std::find(monitors.begin(), monitors.end(), monitor);
+        if (pos != monitors.end()) {
+            monitors.erase(pos);
+            --abilityMonitorsNum_;
+        }
+        if (monitors.empty()) {
+            abilityMonitors_.erase(iter);
+        }
     }
 
-    HILOG_DEBUG("RemoveAbilityMonitor count: %{public}zu", abilityMonitors_.size());
+    HILOG_DEBUG("RemoveAbilityMonitor count: %{public}zu", abilityMonitorsNum_);
 }
 
 void AbilityDelegator::RemoveAbilityStageMonitor(const std::shared_ptr<IAbilityStageMonitor> &monitor)
@@ -98,29 +110,47 @@ void AbilityDelegator::RemoveAbilityStageMonitor(const std::shared_ptr<IAbilityS
     }
 
     std::unique_lock<std::mutex> lck(mutexStageMonitor_);
-    auto pos = std::find(abilityStageMonitors_.begin(), abilityStageMonitors_.end(), monitor);
-    if (pos != abilityStageMonitors_.end()) {
-        abilityStageMonitors_.erase(pos);
+    auto iter = abilityStageMonitors_.find(monitor->GetModuleName());
+    if (iter != abilityStageMonitors_.end()) {
+        auto &monitors = iter->second;
+        auto pos = std::find(monitors.begin(), monitors.end(), monitor);
+        if (pos != monitors.end()) {
+            monitors.erase(pos);
+            --abilityStageMonitorsNum_;
+        }
+        if (monitors.empty()) {
+            abilityStageMonitors_.erase(iter);
+        }
     }
 
-    HILOG_DEBUG("RemoveAbilityStageMonitor count: %{public}zu", abilityStageMonitors_.size());
+    HILOG_DEBUG("RemoveAbilityStageMonitor count: %{public}zu", abilityStageMonitorsNum_);
 }
 
 void AbilityDelegator::ClearAllMonitors()
 {
+    HILOG_INFO("ClearAllMonitors start");
+    {
+        std::unique_lock<std::mutex> lck(mutexMonitor_);
+        abilityMonitors_.clear();
+        abilityMonitorsNum_ = 0;
+    }
+    std::unique_lock<std::mutex> lck(mutexStageMonitor_);
+    abilityStageMonitors_.clear();
+    abilityStageMonitorsNum_ = 0;
 }
 
 size_t AbilityDelegator::GetMonitorsNum()
 {
-    return 0;
+    std::unique_lock<std::mutex> lck(mutexMonitor_);
+    return abilityMonitorsNum_;
 }
 
 size_t AbilityDelegator::GetStageMonitorsNum()
 {
-    return 0;
+    std::unique_lock<std::mutex> lck(mutexStageMonitor_);
+    return abilityStageMonitorsNum_;
 }
 
-
 std::shared_ptr<ADelegatorAbilityProperty> AbilityDelegator::WaitAbilityMonitor(
     const std::shared_ptr<IAbilityMonitor> &monitor)
 {
@@ -373,21 +403,11 @@ void AbilityDelegator::PostPerformStart(const std::shared_ptr<ADelegatorAbilityP
 
     ProcessAbilityProperties(ability);
 
-    std::unique_lock<std::mutex> lck(mutexMonitor_);
-    if (abilityMonitors_.empty()) {
-        HILOG_WARN("Empty abilityMonitors");
-        return;
-    }
-
-    for (const auto &monitor : abilityMonitors_) {
-        if (!monitor) {
-            continue;
-        }
-
+    DispatchAbilityMonitors(ability, [&ability](const std::shared_ptr<IAbilityMonitor> &monitor) {
         if (monitor->Match(ability, true)) {
             monitor->OnAbilityStart(ability->object_);
         }
-    }
+    });
 }
 
 void AbilityDelegator::PostPerformStageStart(const std::shared_ptr<DelegatorAbilityStageProperty> &abilityStage)
@@ -404,10 +424,11 @@ void AbilityDelegator::PostPerformStageStart(const std::shared_ptr<DelegatorAbil
         return;
     }
 
-    for (const auto &monitor : abilityStageMonitors_) {
-        if (!monitor) {
-            continue;
-        }
+    auto iter = abilityStageMonitors_.find(abilityStage->moduleName_);
+    if (iter == abilityStageMonitors_.end()) {
+        return;
+    }
+    for (const auto &monitor : iter->second) {
         monitor->Match(abilityStage, true);
     }
 }
@@ -423,21 +444,11 @@ void AbilityDelegator::PostPerformScenceCreated(const std::shared_ptr<ADelegator
 
     ProcessAbilityProperties(ability);
 
-    std::unique_lock<std::mutex> lck(mutexMonitor_);
-    if (abilityMonitors_.empty()) {
-        HILOG_WARN("Empty abilityMonitors");
-        return;
-    }
-
-    for (const auto &monitor : abilityMonitors_) {
-        if (!monitor) {
-            continue;
-        }
-
+    DispatchAbilityMonitors(ability, [&ability](const std::shared_ptr<IAbilityMonitor> &monitor) {
         if (monitor->Match(ability)) {
             monitor->OnWindowStageCreate(ability->object_);
         }
-    }
+    });
 }
 
 void AbilityDelegator::PostPerformScenceRestored(const std::shared_ptr<ADelegatorAbilityProperty> &ability)
@@ -455,21 +466,11 @@ void AbilityDelegator::PostPerformScenceDestroyed(const std::shared_ptr<ADelegat
 
     ProcessAbilityProperties(ability);
 
-    std::unique_lock<std::mutex> lck(mutexMonitor_);
-    if (abilityMonitors_.empty()) {
-        HILOG_WARN("Empty abilityMonitors");
-        return;
-    }
-
-    for (const auto &monitor : abilityMonitors_) {
-        if (!monitor) {
-            continue;
-        }
-
+    DispatchAbilityMonitors(ability, [&ability](const std::shared_ptr<IAbilityMonitor> &monitor) {
         if (monitor->Match(ability)) {
             monitor->OnWindowStageDestroy(ability->object_);
         }
-    }
+    });
 }
 
 void AbilityDelegator::PostPerformForeground(const std::shared_ptr<ADelegatorAbilityProperty> &ability)
@@ -483,21 +484,11 @@ void AbilityDelegator::PostPerformForeground(const std::shared_ptr<ADelegatorAbi
 
     ProcessAbilityProperties(ability);
 
-    std::unique_lock<std::mutex> lck(mutexMonitor_);
-    if (abilityMonitors_.empty()) {
-        HILOG_WARN("Empty abilityMonitors");
-        return;
-    }
-
-    for (const auto &monitor : abilityMonitors_) {
-        if (!monitor) {
-            continue;
-        }
-
+    DispatchAbilityMonitors(ability, [&ability](const std::shared_ptr<IAbilityMonitor> &monitor) {
         if (monitor->Match(ability)) {
             monitor->OnAbilityForeground(ability->object_);
         }
-    }
+    });
 }
 
 void AbilityDelegator::PostPerformBackground(const std::shared_ptr<ADelegatorAbilityProperty> &ability)
@@ -511,21 +502,11 @@ void AbilityDelegator::PostPerformBackground(const std::shared_ptr<ADelegatorAbi
 
     ProcessAbilityProperties(ability);
 
-    std::unique_lock<std::mutex> lck(mutexMonitor_);
-    if (abilityMonitors_.empty()) {
-        HILOG_WARN("Empty abilityMonitors");
-        return;
-    }
-
-    for (const auto &monitor : abilityMonitors_) {
-        if (!monitor) {
-            continue;
-        }
-
+    DispatchAbilityMonitors(ability, [&ability](const std::shared_ptr<IAbilityMonitor> &monitor) {
         if (monitor->Match(ability)) {
             monitor->OnAbilityBackground(ability->object_);
         }
-    }
+    });
 }
 
 void AbilityDelegator::PostPerformStop(const std::shared_ptr<ADelegatorAbilityProperty> &ability)
@@ -539,21 +520,11 @@ void AbilityDelegator::PostPerformStop(const std::shared_ptr<ADelegatorAbilityPr
 
     ProcessAbilityProperties(ability);
 
-    std::unique_lock<std::mutex> lck(mutexMonitor_);
-    if (abilityMonitors_.empty()) {
-        HILOG_WARN("Empty abilityMonitors");
-        return;
-    }
-
-    for (const auto &monitor : abilityMonitors_) {
-        if (!monitor) {
-            continue;
-        }
-
+    DispatchAbilityMonitors(ability, [&ability](const std::shared_ptr<IAbilityMonitor> &monitor) {
         if (monitor->Match(ability)) {
             monitor->OnAbilityStop(ability->object_);
         }
-    }
+    });
 
     RemoveAbilityProperty(ability);
     CallClearFunc(ability);
@@ -689,6 +660,24 @@ inline void AppExecFwk::AbilityDelegator::CallClearFunc(const std::shared_ptr<AD
     }
 }
 
+void AbilityDelegator::DispatchAbilityMonitors(const std::shared_ptr<ADelegatorAbilityProperty> &ability,
+    const std::function<void(const std::shared_ptr<IAbilityMonitor> &)> &func)
+{
+    std::unique_lock<std::mutex> lck(mutexMonitor_);
+    if (abilityMonitors_.empty()) {
+        HILOG_WARN("Empty abilityMonitors");
+        return;
+    }
+
+    auto iter = abilityMonitors_.find(ability->name_);
+    if (iter == abilityMonitors_.end()) {
+        return;
+    }
+    for (const auto &monitor : iter->second) {
+        func(monitor);
+    }
+}
+
 Ace::Platform::UIContent* AbilityDelegator::GetUIContent(int32_t instanceId)
 {
     std::shared_lock<std::shared_mutex> lock(mutex_);
@@ -23,6 +23,11 @@ namespace AppExecFwk {
 IAbilityMonitor::IAbilityMonitor(const std::string &abilityName) : abilityName_(abilityName)
 {}
 
+const std::string &IAbilityMonitor::GetAbilityName() const
+{
+    return abilityName_;
+}
+
 bool IAbilityMonitor::Match(const std::shared_ptr<ADelegatorAbilityProperty> &ability, bool isNotify)
 {
     if (!ability) {
@@ -22,6 +22,11 @@ IAbilityStageMonitor::IAbilityStageMonitor(const std::string &moduleName, const
     : moduleName_(moduleName), srcEntrance_(srcEntrance)
 {}
 
+const std::string &IAbilityStageMonitor::GetModuleName() const
+{
+    return moduleName_;
+}
+
 bool IAbilityStageMonitor::Match(const std::shared_ptr<DelegatorAbilityStageProperty> &abilityStage, bool isNotify)
 {
     if (!abilityStage) {
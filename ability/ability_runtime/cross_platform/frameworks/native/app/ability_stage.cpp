@@ -79,7 +79,7 @@ std::shared_ptr<Context> AbilityStage::GetContext() const
     return stageContext_;
 }
 
-void AbilityStage::LaunchAbility(const AAFwk::Want& want, const std::unique_ptr<Runtime>& runtime)
+void AbilityStage::LaunchAbility(AAFwk::Want&& want, const std::unique_ptr<Runtime>& runtime)
 {
     HILOG_INFO("AbilityStage::LaunchAbility called.");
     Ace::AceScopedTrace trace("LaunchAbility");
@@ -124,7 +124,8 @@ void AbilityStage::LaunchAbility(const AAFwk::Want& want, const std::unique_ptr<
     newAbility->SetAbilityContext(abilityContext);
     newAbility->Init(abilityInfo);
     newAbility->SetInstanceName(want.GetStringParam(Want::INSTANCE_NAME));
-    newAbility->OnCreate(want);
+    newAbility->SetWant(std::move(want));
+    newAbility->OnCreate(*newAbility->GetWant());
 
     abilities_.emplace(abilityName, newAbility);
 }
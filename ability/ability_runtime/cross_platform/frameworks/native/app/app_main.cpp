@@ -30,14 +30,20 @@
 #include "base/log/ace_trace.h"
 #include "base/utils/string_utils.h"
 #include "hilog.h"
+#include "hsp_module_json_cache.h"
+#include "js_console_log.h"
 #include "js_error_logger.h"
 #include "js_runtime.h"
 #include "js_runtime_utils.h"
+#include "launch_event_logger.h"
 #include "load_module_helper.h"
 #include "module_load_callback.h"
 #include "native_module_manager.h"
 #include "preload_manager.h"
 #include "runtime.h"
+#include "startup_task_graph.h"
+#include "startup_timeline.h"
+#include "want_binary_codec.h"
 
 #include "base/log/ace_trace.h"
 #include "base/utils/string_utils.h"
@@ -84,6 +90,7 @@ void AppMain::LaunchApplication(bool isCopyNativeLibs, bool shouldLoadUI)
         return;
     }
 
+    StartupTimeline::GetInstance().Start();
     auto task = [isCopyNativeLibs, shouldLoadUI]() {
         AppMain::GetInstance()->ScheduleLaunchApplication(isCopyNativeLibs, shouldLoadUI);
     };
@@ -94,8 +101,7 @@ void AppMain::ScheduleLaunchApplication(bool isCopyNativeLibs, bool shouldLoadUI
 {
     HILOG_INFO("AppMain schedule launch application.");
     Ace::AceScopedTrace trace("ScheduleLaunchApplication");
-
-    LoadIcuData();
+    StartupPhase phase("ScheduleLaunchApplication");
 
     shouldLoadUI_ = shouldLoadUI;
     bundleContainer_ = std::make_shared<AppExecFwk::BundleContainer>();
@@ -103,44 +109,66 @@ void AppMain::ScheduleLaunchApplication(bool isCopyNativeLibs, bool shouldLoadUI
         HILOG_ERROR("bundleContainer_ is nullptr");
         return;
     }
-    StageAssetManager::GetInstance()->InitModuleVersionCode();
-    auto moduleList = StageAssetManager::GetInstance()->GetModuleJsonBufferList();
-    HILOG_INFO("module list size: %{public}d", static_cast<int32_t>(moduleList.size()));
-    if (!moduleList.empty()) {
-        bundleContainer_->LoadBundleInfos(moduleList);
-    }
-    bundleContainer_->SetAppCodePath(StageAssetManager::GetInstance()->GetBundleCodeDir());
-    bundleContainer_->SetPidAndUid(pid_, uid_);
-#ifdef ANDROID_PLATFORM
-    auto bundleName = bundleContainer_->GetBundleName();
-    if (isCopyNativeLibs && !bundleName.empty()) {
-        StageAssetManager::GetInstance()->CopyNativeLibToAppDataModuleDir(bundleName);
-    }
-#endif
     application_ = std::make_shared<Application>();
     if (application_ == nullptr) {
         HILOG_ERROR("application_ is nullptr");
         return;
     }
-    application_->SetBundleContainer(bundleContainer_);
-
     auto applicationContext = ApplicationContext::GetInstance();
     if (applicationContext == nullptr) {
         HILOG_ERROR("applicationContext is nullptr");
         return;
     }
-    struct timespec t;
-    t.tv_sec = 0;
-    t.tv_nsec = 0;
-    clock_gettime(CLOCK_MONOTONIC, &t);
-    applicationContext->SetAppRunningUniqueId(
-        std::to_string(static_cast<int64_t>((t.tv_sec) * NANOSECONDS + t.tv_nsec) / MICROSECONDS));
-    applicationContext->SetBundleContainer(bundleContainer_);
-    ParseBundleComplete();
+
+    // Every step reads platform assets, so all of them run here on the launching thread.
+    StartupTaskGraph taskGraph;
+    taskGraph.AddTask("LoadIcuData", [this]() { LoadIcuData(); });
+    taskGraph.AddTask("LoadBundleInfos", [this]() { LoadBundleInfos(); });
+    std::vector<std::string> runtimeDependencies { "LoadIcuData", "InitApplicationContext" };
+#ifdef ANDROID_PLATFORM
+    auto copyNativeLibs = [this, isCopyNativeLibs]() {
+        auto bundleName = bundleContainer_->GetBundleName();
+        if (isCopyNativeLibs && !bundleName.empty()) {
+            StageAssetManager::GetInstance()->CopyNativeLibToAppDataModuleDir(bundleName);
+        }
+    };
+    taskGraph.AddTask("CopyNativeLibs", copyNativeLibs, { "LoadBundleInfos" });
+    runtimeDependencies.emplace_back("CopyNativeLibs");
+#endif
+    auto initApplicationContext = [this, applicationContext]() {
+        application_->SetBundleContainer(bundleContainer_);
+        struct timespec t;
+        t.tv_sec = 0;
+        t.tv_nsec = 0;
+        clock_gettime(CLOCK_MONOTONIC, &t);
+        applicationContext->SetAppRunningUniqueId(
+            std::to_string(static_cast<int64_t>((t.tv_sec) * NANOSECONDS + t.tv_nsec) / MICROSECONDS));
+        applicationContext->SetBundleContainer(bundleContainer_);
+    };
+    taskGraph.AddTask("InitApplicationContext", initApplicationContext, { "LoadBundleInfos" });
+    taskGraph.AddTask("ParseBundleComplete", [this]() { ParseBundleComplete(); }, runtimeDependencies);
+    // A rejected step, e.g. a misspelt dependency, fails the launch instead of silently skipping the step.
+    if (!taskGraph.Run()) {
+        HILOG_ERROR("Launch application failed, invalid startup task graph.");
+        return;
+    }
+    taskGraph.DumpReport();
 
     HILOG_INFO("Launch application success.");
 }
 
+void AppMain::LoadBundleInfos()
+{
+    StageAssetManager::GetInstance()->InitModuleVersionCode();
+    auto moduleList = StageAssetManager::GetInstance()->GetModuleJsonBufferList();
+    HILOG_INFO("module list size: %{public}d", static_cast<int32_t>(moduleList.size()));
+    if (!moduleList.empty()) {
+        bundleContainer_->LoadBundleInfos(moduleList);
+    }
+    bundleContainer_->SetAppCodePath(StageAssetManager::GetInstance()->GetBundleCodeDir());
+    bundleContainer_->SetPidAndUid(pid_, uid_);
+}
+
 void AppMain::PrepareAbilityDelegator(const std::string& bundleName, const std::string& moduleName,
     const std::string& testRunerName, const std::string& timeout, const std::string& socket)
 {
@@ -209,7 +237,15 @@ bool AppMain::CreateRuntime(const std::string& bundleName, bool isBundle)
     options.stubFilePath = StageAssetManager::GetInstance()->GetStubFilePath();
     options.appDataLibPath = StageAssetManager::GetInstance()->GetAppDataLibDir();
 #endif
-    auto bundleinfo = bundleContainer_->GetBundleInfo();
+    auto applicationInfo = bundleContainer_->GetApplicationInfoSnapshot();
+    if (applicationInfo != nullptr && !applicationInfo->debug) {
+        // Debug builds are reinstalled without bumping the version code, so they never use the module cache.
+        options.moduleCacheDir = StageAssetManager::GetInstance()->GetCacheDir();
+        options.versionCode = applicationInfo->versionCode;
+        // Release builds batch console output on a background thread.
+        options.asyncConsoleLog = true;
+    }
+    auto bundleinfo = bundleContainer_->GetBundleInfoSnapshot();
     if (bundleinfo != nullptr) {
         for (const auto& hapModuleInfo : bundleinfo->hapModuleInfos) {
             auto moduleName = hapModuleInfo.moduleName;
@@ -252,7 +288,7 @@ void AppMain::ParseBundleComplete()
     }
     application_->SetApplicationContext(applicationContext);
 
-    auto bundleInfo = bundleContainer_->GetBundleInfo();
+    auto bundleInfo = bundleContainer_->GetBundleInfoSnapshot();
     if (applicationInfo == nullptr || bundleInfo == nullptr) {
         HILOG_ERROR("applicationInfo or bundleInfo is nullptr.");
         return;
@@ -277,7 +313,7 @@ void AppMain::UpdateRuntimePkgContextInfo(const std::string& moduleName)
         return;
     }
 
-    auto hapModuleInfo = bundleContainer_->GetHapModuleInfo(moduleName);
+    auto hapModuleInfo = bundleContainer_->GetHapModuleInfoSnapshot(moduleName);
     if (hapModuleInfo == nullptr) {
         HILOG_ERROR("hapModuleInfo is nullptr, moduleName: %{public}s", moduleName.c_str());
         return;
@@ -443,11 +479,17 @@ void UpdateModuleConfiguration(const std::string& moduleName)
 void AppMain::HandleDispatchOnCreate(const std::string& instanceName, const std::string& params)
 {
     HILOG_INFO("HandleDispatchOnCreate called, instanceName: %{public}s", instanceName.c_str());
+    StartupPhase phase("DispatchOnCreate");
     if (application_ == nullptr || bundleContainer_ == nullptr) {
         HILOG_ERROR("application_ is nullptr");
         return;
     }
-    auto want = TransformToWant(instanceName);
+    // The Want is parsed once here and moved down to the ability that keeps it.
+    Want want;
+    if (!TransformToWant(instanceName, params, want)) {
+        HILOG_ERROR("HandleDispatchOnCreate failed, invalid want params.");
+        return;
+    }
     std::string moduleName = want.GetModuleName();
     std::string bundleName = want.GetBundleName();
     UpdateAbilityBundleName(bundleName);
@@ -458,9 +500,10 @@ void AppMain::HandleDispatchOnCreate(const std::string& instanceName, const std:
         StageAssetManager::GetInstance()->RemoveModuleFilePath(moduleName);
 #endif
         bundleContainer_->RemoveModuleInfo(moduleName);
+        AppExecFwk::HspModuleJsonCache::GetInstance().Invalidate(GetHspModuleJsonPath(moduleName));
     }
     UpdateModuleConfiguration(moduleName);
-    auto hapModuleInfo = bundleContainer_->GetHapModuleInfo(moduleName);
+    auto hapModuleInfo = bundleContainer_->GetHapModuleInfoSnapshot(moduleName);
     if (hapModuleInfo == nullptr) {
         auto moduleList = StageAssetManager::GetInstance()->GetModuleJsonBufferList();
         auto jsonFile = StageAssetManager::GetInstance()->GetAppDataModuleDir() + '/' + moduleName + "/module.json";
@@ -471,7 +514,7 @@ void AppMain::HandleDispatchOnCreate(const std::string& instanceName, const std:
             bundleContainer_->LoadBundleInfos(moduleList);
             if (application_->GetRuntime() == nullptr) {
                 ParseBundleComplete();
-                hapModuleInfo = bundleContainer_->GetHapModuleInfo(moduleName);
+                hapModuleInfo = bundleContainer_->GetHapModuleInfoSnapshot(moduleName);
             }
             UpdateRuntimePkgContextInfo(moduleName);
         }
@@ -496,7 +539,7 @@ void AppMain::HandleDispatchOnCreate(const std::string& instanceName, const std:
     }
     StageAssetManager::GetInstance()->SetNativeLibPaths(hapModuleInfo->bundleName, moduleNames);
 #endif
-    application_->HandleAbilityStage(TransformToWant(instanceName, params));
+    application_->HandleAbilityStage(std::move(want));
 }
 
 void AppMain::UpdateAbilityBundleName(const std::string& bundleName)
@@ -517,7 +560,12 @@ void AppMain::HandleDispatchOnNewWant(const std::string& instanceName, const std
         return;
     }
 
-    application_->DispatchOnNewWant(TransformToWant(instanceName, params));
+    Want want;
+    if (!TransformToWant(instanceName, params, want)) {
+        HILOG_ERROR("HandleDispatchOnNewWant failed, invalid want params.");
+        return;
+    }
+    application_->DispatchOnNewWant(std::move(want));
 }
 
 void AppMain::HandleDispatchOnForeground(const std::string& instanceName)
@@ -527,10 +575,39 @@ void AppMain::HandleDispatchOnForeground(const std::string& instanceName)
         HILOG_ERROR("application_ is nullptr");
         return;
     }
-    auto want = TransformToWant(instanceName);
-    std::string bundleName = want.GetBundleName();
-    UpdateAbilityBundleName(bundleName);
-    application_->DispatchOnForeground(want);
+    {
+        StartupPhase phase("DispatchOnForeground");
+        auto want = TransformToWant(instanceName);
+        std::string bundleName = want.GetBundleName();
+        UpdateAbilityBundleName(bundleName);
+        application_->DispatchOnForeground(want);
+    }
+    if (!launchReported_) {
+        launchReported_ = true;
+        ReportLaunchEvent();
+    }
+}
+
+void AppMain::ReportLaunchEvent()
+{
+    auto applicationContext = ApplicationContext::GetInstance();
+    auto applicationInfo = bundleContainer_ != nullptr ? bundleContainer_->GetApplicationInfoSnapshot() : nullptr;
+    if (applicationContext == nullptr || applicationInfo == nullptr) {
+        HILOG_ERROR("applicationContext or applicationInfo is nullptr");
+        return;
+    }
+    auto& timeline = StartupTimeline::GetInstance();
+    LaunchEventInfo info;
+    info.appRunningId = applicationContext->GetAppRunningUniqueId();
+    info.bundleName = applicationInfo->bundleName;
+    info.versionName = applicationInfo->versionName;
+    info.pid = pid_;
+    info.uid = uid_;
+    info.totalTime = timeline.GetElapsedTime();
+    info.timeline = timeline.ExportJson();
+    HILOG_INFO("Launch finished in %{public}lld us, timeline: %{public}s", static_cast<long long>(info.totalTime),
+        info.timeline.c_str());
+    LaunchEventLogger::SendLaunchEvent(info);
 }
 
 void AppMain::HandleDispatchOnBackground(const std::string& instanceName)
@@ -581,7 +658,14 @@ void AppMain::HandleInitConfiguration(const std::string& jsonConfiguration)
     application_->InitConfiguration(configuration);
 }
 
-Want AppMain::TransformToWant(const std::string& instanceName, const std::string& params)
+Want AppMain::TransformToWant(const std::string& instanceName)
+{
+    Want want;
+    TransformToWant(instanceName, "", want);
+    return want;
+}
+
+bool AppMain::TransformToWant(const std::string& instanceName, const std::string& params, Want& want)
 {
     std::vector<std::string> nameStrs;
     Ace::StringUtils::StringSplitter(instanceName, ':', nameStrs);
@@ -589,7 +673,13 @@ Want AppMain::TransformToWant(const std::string& instanceName, const std::string
         HILOG_INFO("TransformToWant::str : %{public}s", str.c_str());
     }
 
-    Want want;
+    // The platform sends either the JSON text or the binary encoding, which is decoded in place.
+    // A payload that fails to decode is rejected, the caller must not dispatch a Want missing its content.
+    bool isBinary = AAFwk::WantBinaryCodec::IsBinary(params);
+    if (isBinary && !want.ParseBinary(reinterpret_cast<const uint8_t*>(params.data()), params.size())) {
+        HILOG_ERROR("TransformToWant parse binary params failed, size: %{public}zu.", params.size());
+        return false;
+    }
     if (nameStrs.size() == 4) {
         want.SetBundleName(nameStrs[0]);
         want.SetModuleName(nameStrs[1]);
@@ -597,8 +687,10 @@ Want AppMain::TransformToWant(const std::string& instanceName, const std::string
         want.SetParam(Want::ABILITY_ID, nameStrs[3]);
         want.SetParam(Want::INSTANCE_NAME, instanceName);
     }
-    want.ParseJson(params);
-    return want;
+    if (!isBinary) {
+        want.ParseJson(params);
+    }
+    return true;
 }
 
 void AppMain::SetPidAndUid(int32_t pid, int32_t uid)
@@ -614,7 +706,7 @@ bool AppMain::IsSingleton(const std::string& moduleName, const std::string& abil
         HILOG_ERROR("bundleContainer_ is nullptr");
         return false;
     }
-    auto abilityInfo = bundleContainer_->GetAbilityInfo(moduleName, abilityName);
+    auto abilityInfo = bundleContainer_->GetAbilityInfoSnapshot(moduleName, abilityName);
     if (abilityInfo == nullptr) {
         HILOG_ERROR("abilityInfo is nullptr");
         return false;
@@ -645,7 +737,15 @@ void AppMain::HandleDispatchOnAbilityResult(
         return;
     }
     Want abilityResultWant;
-    abilityResultWant.ParseJson(resultWant);
+    if (AAFwk::WantBinaryCodec::IsBinary(resultWant)) {
+        // The result is still delivered so the caller's request completes, only without the lost data.
+        if (!abilityResultWant.ParseBinary(reinterpret_cast<const uint8_t*>(resultWant.data()), resultWant.size())) {
+            HILOG_ERROR("Parse binary result want failed, the result is dispatched without it.");
+            abilityResultWant = Want();
+        }
+    } else {
+        abilityResultWant.ParseJson(resultWant);
+    }
     application_->DispatchOnAbilityResult(
         TransformToWant(instanceName), requestCode, resultCode, abilityResultWant);
 }
@@ -656,7 +756,7 @@ void AppMain::RegisterUncaughtExceptionHandler(Runtime* runtime)
         HILOG_ERROR("AppMain RegisterUncaughtExceptionHandler failed, runtime or bundleContainer_ is nullptr");
         return;
     }
-    auto bundleInfo = bundleContainer_->GetBundleInfo();
+    auto bundleInfo = bundleContainer_->GetBundleInfoSnapshot();
     if (bundleInfo == nullptr) {
         HILOG_ERROR("bundleInfo is nullptr");
         return;
@@ -688,7 +788,7 @@ void AppMain::FillUncaughtExceptionInfo(JsEnv::UncaughtExceptionInfo& info, cons
         return;
     }
     auto applicationContext = application_->GetApplicationContext();
-    auto applicationInfo = bundleContainer_->GetApplicationInfo();
+    auto applicationInfo = bundleContainer_->GetApplicationInfoSnapshot();
     if (applicationContext == nullptr || applicationInfo == nullptr) {
         HILOG_ERROR("applicationContext or applicationInfo is nullptr");
         return;
@@ -715,6 +815,7 @@ void AppMain::FillUncaughtExceptionInfo(JsEnv::UncaughtExceptionInfo& info, cons
         if (sharedThis->application_ == nullptr) {
             return;
         }
+        FlushConsoleLog();
         JsErrorLogger::SendExceptionToJsError(jsInfo, appExecErrorObj, sharedThis->application_->IsForegroud());
         auto& runtime = sharedThis->application_->GetRuntime();
         if (runtime == nullptr) {
@@ -732,6 +833,26 @@ void AppMain::FillUncaughtExceptionInfo(JsEnv::UncaughtExceptionInfo& info, cons
     };
 }
 
+std::string AppMain::GetHspModuleJsonPath(const std::string& moduleName)
+{
+    return StageAssetManager::GetInstance()->GetAppDataModuleDir() + '/' + moduleName + "/module.json";
+}
+
+bool AppMain::LoadHspModuleInfo(const std::string& moduleName)
+{
+    auto loader = [](const std::string& jsonPath) {
+        return StageAssetManager::GetInstance()->GetBufferByAppDataPath(jsonPath);
+    };
+    auto moduleInfo = AppExecFwk::HspModuleJsonCache::GetInstance().GetModuleInfo(
+        GetHspModuleJsonPath(moduleName), loader);
+    if (moduleInfo == nullptr) {
+        HILOG_ERROR("Get hsp module info failed.");
+        return false;
+    }
+    bundleContainer_->LoadModuleInfo(*moduleInfo);
+    return true;
+}
+
 void AppMain::ParseHspModuleJson(const std::string& moduleName)
 {
     if (bundleContainer_ == nullptr) {
@@ -742,19 +863,14 @@ void AppMain::ParseHspModuleJson(const std::string& moduleName)
     if (isDynamicModule) {
         bundleContainer_->RemoveModuleInfo(moduleName);
     }
-    auto hapModuleInfo = bundleContainer_->GetHapModuleInfo(moduleName);
-    if (hapModuleInfo != nullptr) {
+    if (bundleContainer_->HasModuleInfo(moduleName)) {
         HILOG_WARN("Module has been parsed");
         return;
     }
-    auto jsonFile = StageAssetManager::GetInstance()->GetAppDataModuleDir() + '/' + moduleName + "/module.json";
-    auto dynamicModuleJson = StageAssetManager::GetInstance()->GetBufferByAppDataPath(jsonFile);
-    if (dynamicModuleJson.empty()) {
-        HILOG_ERROR("Get buffer by module path failed.");
+    // An updated module.json is detected by the cache itself, an unchanged one is not parsed again.
+    if (!LoadHspModuleInfo(moduleName)) {
         return;
     }
-    std::list<std::vector<uint8_t>> moduleList { dynamicModuleJson };
-    bundleContainer_->LoadBundleInfos(moduleList);
     ModuleLoadCallbackManager::GetInstance().NotifyAll();
 }
 
@@ -829,6 +945,9 @@ void AppMain::HandlePreloadModule(const std::string& moduleName, const std::stri
     }
 
     auto abilityInfo = bundleContainer_->GetAbilityInfo(moduleName, abilityName);
+    if (abilityInfo == nullptr && !bundleContainer_->HasModuleInfo(moduleName) && LoadHspModuleInfo(moduleName)) {
+        abilityInfo = bundleContainer_->GetAbilityInfo(moduleName, abilityName);
+    }
     if (abilityInfo == nullptr) {
         HILOG_ERROR("abilityInfo is nullptr");
         return;
@@ -18,6 +18,7 @@
 #include "ability_stage_context.h"
 #include "hilog.h"
 #include "js_runtime.h"
+#include "startup_timeline.h"
 #include "base/log/ace_trace.h"
 #include "core/common/ace_application_info.h"
 
@@ -63,7 +64,7 @@ void Application::UpdateAbilityBundleName(const std::string& bundleName)
     Ace::AceApplicationInfo::GetInstance().SetPackageName(bundleName);
 }
 
-void Application::HandleAbilityStage(const AAFwk::Want& want)
+void Application::HandleAbilityStage(AAFwk::Want&& want)
 {
     HILOG_INFO("Application::HandleAbilityStage");
     Ace::AceScopedTrace trace("HandleAbilityStage");
@@ -82,7 +83,7 @@ void Application::HandleAbilityStage(const AAFwk::Want& want)
     UpdateAbilityBundleName(bundleName);
     auto stage = FindAbilityStage(moduleName);
     if (stage != nullptr) {
-        stage->LaunchAbility(want, runtime_);
+        stage->LaunchAbility(std::move(want), runtime_);
         return;
     }
 
@@ -111,11 +112,16 @@ void Application::HandleAbilityStage(const AAFwk::Want& want)
     abilityStageContext->InitResourceManeger();
     applicationContext_->SetResourceManager(abilityStageContext->GetResourceManager());
 
-    auto abilityStage = AbilityRuntime::Platform::AbilityStage::Create(runtime_, *hapModuleInfo);
-    abilityStage->Init(abilityStageContext);
-    abilityStage->SetBundleContainer(bundleContainer_);
-    abilityStage->OnCreate();
-    abilityStage->LaunchAbility(want, runtime_);
+    std::shared_ptr<AbilityRuntime::Platform::AbilityStage> abilityStage;
+    {
+        StartupPhase phase("AbilityStage::Create");
+        abilityStage = AbilityRuntime::Platform::AbilityStage::Create(runtime_, *hapModuleInfo);
+        abilityStage->Init(abilityStageContext);
+        abilityStage->SetBundleContainer(bundleContainer_);
+        abilityStage->OnCreate();
+    }
+    StartupPhase phase("LaunchAbility");
+    abilityStage->LaunchAbility(std::move(want), runtime_);
 
     abilityStages_.emplace(moduleName, abilityStage);
 }
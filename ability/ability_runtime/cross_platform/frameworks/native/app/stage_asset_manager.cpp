@@ -19,6 +19,9 @@
 #include <string>
 
 #include "hilog.h"
+#include "js_asset_buffer.h"
+#include "js_module_cache.h"
+#include "js_worker_asset_cache.h"
 #include "stage_asset_provider.h"
 
 namespace OHOS {
@@ -56,13 +59,95 @@ std::vector<uint8_t> StageAssetManager::GetFontConfigJsonBuffer(const std::strin
 std::vector<uint8_t> StageAssetManager::GetModuleBuffer(
     const std::string& moduleName, std::string& modulePath, bool esmodule)
 {
-    return StageAssetProvider::GetInstance()->GetModuleBuffer(moduleName, modulePath, esmodule);
+    std::string cacheKey = moduleName + (esmodule ? ":esmodule" : ":bundle");
+    std::vector<uint8_t> buffer;
+    if (LoadModuleCache(moduleName, cacheKey, modulePath, buffer)) {
+        return buffer;
+    }
+    buffer = StageAssetProvider::GetInstance()->GetModuleBuffer(moduleName, modulePath, esmodule);
+    StoreModuleCache(moduleName, cacheKey, modulePath, buffer);
+    return buffer;
+}
+
+std::shared_ptr<AbilityRuntime::JsAssetBuffer> StageAssetManager::GetModuleMappedBuffer(
+    const std::string& moduleName, std::string& modulePath, bool esmodule)
+{
+    std::string cacheKey = moduleName + (esmodule ? ":esmodule" : ":bundle");
+    auto& moduleCache = AbilityRuntime::JsModuleCache::GetInstance();
+    if (!IsDynamicUpdateModule(moduleName)) {
+        auto assetBuffer = moduleCache.LoadMapped(moduleName, cacheKey, modulePath);
+        if (assetBuffer != nullptr) {
+            return assetBuffer;
+        }
+    } else {
+        InvalidateModuleCache(moduleName);
+    }
+    // Assets inside the application package may be compressed, fall back to the copied buffer.
+    auto assetBuffer = AbilityRuntime::JsAssetBuffer::FromBuffer(
+        StageAssetProvider::GetInstance()->GetModuleBuffer(moduleName, modulePath, esmodule));
+    StoreModuleCache(moduleName, cacheKey, modulePath, assetBuffer);
+    return assetBuffer;
 }
 
 std::vector<uint8_t> StageAssetManager::GetModuleAbilityBuffer(
     const std::string& moduleName, const std::string& abilityName, std::string& modulePath, bool esmodule)
 {
-    return StageAssetProvider::GetInstance()->GetModuleAbilityBuffer(moduleName, abilityName, modulePath, esmodule);
+    std::string cacheKey = moduleName + "/" + abilityName + (esmodule ? ":esmodule" : ":bundle");
+    std::vector<uint8_t> buffer;
+    if (LoadModuleCache(moduleName, cacheKey, modulePath, buffer)) {
+        return buffer;
+    }
+    buffer = StageAssetProvider::GetInstance()->GetModuleAbilityBuffer(moduleName, abilityName, modulePath, esmodule);
+    StoreModuleCache(moduleName, cacheKey, modulePath, buffer);
+    return buffer;
+}
+
+bool StageAssetManager::LoadModuleCache(const std::string& moduleName, const std::string& cacheKey,
+    std::string& modulePath, std::vector<uint8_t>& buffer)
+{
+    // Same rule as JsRuntime::IsNeedUpdate, a dynamically updated module drops everything cached for it.
+    if (IsDynamicUpdateModule(moduleName)) {
+        InvalidateModuleCache(moduleName);
+        return false;
+    }
+    return AbilityRuntime::JsModuleCache::GetInstance().Load(moduleName, cacheKey, modulePath, buffer);
+}
+
+void StageAssetManager::StoreModuleCache(const std::string& moduleName, const std::string& cacheKey,
+    const std::string& modulePath, const std::vector<uint8_t>& buffer)
+{
+    if (buffer.empty() || !AbilityRuntime::JsModuleCache::GetInstance().IsEnabled()) {
+        return;
+    }
+    // The caller keeps its buffer, the background writer gets its own copy.
+    StoreModuleCache(moduleName, cacheKey, modulePath,
+        AbilityRuntime::JsAssetBuffer::FromBuffer(std::vector<uint8_t>(buffer)));
+}
+
+void StageAssetManager::StoreModuleCache(const std::string& moduleName, const std::string& cacheKey,
+    const std::string& modulePath, const std::shared_ptr<AbilityRuntime::JsAssetBuffer>& assetBuffer)
+{
+    // A dynamically updated module is invalidated on every load, a copy of it would never be read.
+    if (IsDynamicUpdateModule(moduleName)) {
+        return;
+    }
+    AbilityRuntime::JsModuleCache::GetInstance().Store(moduleName, cacheKey, modulePath, assetBuffer);
+}
+
+void StageAssetManager::InvalidateModuleCache(const std::string& moduleName)
+{
+    AbilityRuntime::JsModuleCache::GetInstance().InvalidateModule(moduleName);
+    AbilityRuntime::JsWorkerAssetCache::GetInstance().InvalidateModule(moduleName);
+}
+
+uint64_t StageAssetManager::GetModuleGeneration() const
+{
+    return moduleGeneration_.load(std::memory_order_acquire);
+}
+
+void StageAssetManager::BumpModuleGeneration()
+{
+    moduleGeneration_.fetch_add(1, std::memory_order_acq_rel);
 }
 
 std::string StageAssetManager::GetBundleCodeDir() const
@@ -130,6 +215,8 @@ void StageAssetManager::SetNativeLibPaths(
 void StageAssetManager::RemoveModuleFilePath(const std::string& moduleName)
 {
     StageAssetProvider::GetInstance()->RemoveModuleFilePath(moduleName);
+    InvalidateModuleCache(moduleName);
+    BumpModuleGeneration();
 }
 
 bool StageAssetManager::IsDynamicLoadLibs()
@@ -169,6 +256,9 @@ std::vector<uint8_t> StageAssetManager::GetBufferByAppDataPath(const std::string
 void StageAssetManager::isDynamicModule(const std::string& moduleName, bool needUpdate)
 {
     StageAssetProvider::GetInstance()->UpdateVersionCode(moduleName, needUpdate);
+    if (needUpdate && IsDynamicUpdateModule(moduleName)) {
+        BumpModuleGeneration();
+    }
 }
 
 void StageAssetManager::SetBundleName(const std::string& bundleName)
@@ -184,6 +274,7 @@ std::string StageAssetManager::GetSplicingModuleName(const std::string& moduleNa
 void StageAssetManager::InitModuleVersionCode()
 {
     StageAssetProvider::GetInstance()->InitModuleVersionCode();
+    BumpModuleGeneration();
 }
 
 bool StageAssetManager::IsDynamicUpdateModule(const std::string& moduleName)
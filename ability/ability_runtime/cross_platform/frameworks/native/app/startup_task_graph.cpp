@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "startup_task_graph.h"
+
+#include <chrono>
+#include <deque>
+
+#include "hilog.h"
+#include "startup_timeline.h"
+
+namespace OHOS {
+namespace AbilityRuntime {
+namespace Platform {
+namespace {
+int64_t GetNowMicroseconds()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+} // namespace
+
+int64_t StartupTaskGraph::GetElapsedTime() const
+{
+    return GetNowMicroseconds() - beginTime_;
+}
+
+size_t StartupTaskGraph::FindTask(const std::string& name) const
+{
+    for (size_t index = 0; index < nodes_.size(); ++index) {
+        if (nodes_[index].record.name == name) {
+            return index;
+        }
+    }
+    return nodes_.size();
+}
+
+bool StartupTaskGraph::AddTask(const std::string& name, Task task, const std::vector<std::string>& dependencies)
+{
+    if (!task || FindTask(name) != nodes_.size()) {
+        HILOG_ERROR("Startup task %{public}s is empty or duplicated.", name.c_str());
+        valid_ = false;
+        return false;
+    }
+    std::vector<size_t> dependencyIndexes;
+    for (const auto& dependency : dependencies) {
+        size_t dependencyIndex = FindTask(dependency);
+        if (dependencyIndex == nodes_.size()) {
+            HILOG_ERROR("Startup task %{public}s depends on unknown task %{public}s.", name.c_str(),
+                dependency.c_str());
+            valid_ = false;
+            return false;
+        }
+        dependencyIndexes.emplace_back(dependencyIndex);
+    }
+
+    size_t index = nodes_.size();
+    TaskNode node;
+    node.task = std::move(task);
+    node.pendingCount = dependencyIndexes.size();
+    node.record.name = name;
+    nodes_.emplace_back(std::move(node));
+    for (size_t dependencyIndex : dependencyIndexes) {
+        nodes_[dependencyIndex].dependents.emplace_back(index);
+    }
+    return true;
+}
+
+bool StartupTaskGraph::Run()
+{
+    if (!valid_) {
+        HILOG_ERROR("Startup task graph is invalid, no task runs.");
+        return false;
+    }
+
+    beginTime_ = GetNowMicroseconds();
+    std::deque<size_t> readyQueue;
+    for (size_t index = 0; index < nodes_.size(); ++index) {
+        if (nodes_[index].pendingCount == 0) {
+            readyQueue.emplace_back(index);
+        }
+    }
+    while (!readyQueue.empty()) {
+        auto& node = nodes_[readyQueue.front()];
+        readyQueue.pop_front();
+        node.record.startTime = GetElapsedTime();
+        {
+            StartupPhase phase(node.record.name);
+            node.task();
+        }
+        node.record.endTime = GetElapsedTime();
+        for (size_t dependent : node.dependents) {
+            // The dependency finishing last is the one the dependent actually waited on.
+            nodes_[dependent].record.waitedOn = node.record.name;
+            if (--nodes_[dependent].pendingCount == 0) {
+                readyQueue.emplace_back(dependent);
+            }
+        }
+    }
+    return true;
+}
+
+std::vector<StartupTaskGraph::TaskRecord> StartupTaskGraph::GetRecords() const
+{
+    std::vector<TaskRecord> records;
+    records.reserve(nodes_.size());
+    for (const auto& node : nodes_) {
+        records.emplace_back(node.record);
+    }
+    return records;
+}
+
+void StartupTaskGraph::DumpReport() const
+{
+    for (const auto& record : GetRecords()) {
+        HILOG_INFO("Startup task %{public}s: %{public}lld - %{public}lld us, waited on: %{public}s.",
+            record.name.c_str(), static_cast<long long>(record.startTime), static_cast<long long>(record.endTime),
+            record.waitedOn.empty() ? "none" : record.waitedOn.c_str());
+    }
+}
+} // namespace Platform
+} // namespace AbilityRuntime
+} // namespace OHOS
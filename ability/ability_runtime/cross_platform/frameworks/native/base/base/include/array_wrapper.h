@@ -17,6 +17,8 @@
 #define OHOS_ABILITY_BASE_ARRAY_WRAPPER_H
 
 #include <functional>
+#include <string>
+#include <variant>
 #include <vector>
 
 #include "base_obj.h"
@@ -74,6 +76,26 @@ public:
 
     static sptr<IArray> ParseCrossPlatformArray(const nlohmann::json& arrayStr); /* [in] */
 
+    /**
+     * Creates an array of bool, byte, short, int, long, float, double or string elements stored unboxed in
+     * one contiguous vector. Elements are only boxed when read one at a time through the IArray interface.
+     */
+    template<typename T>
+    static sptr<IArray> Pack(std::vector<T> &&values); /* [in] */
+
+    /**
+     * Copies all elements of an array of the matching type into values, without boxing when it is packed.
+     * Returns false if the element type of the array does not match.
+     */
+    template<typename T>
+    static bool Unpack(IArray *array, /* [in] */
+        std::vector<T> &values);      /* [out] */
+
+    /**
+     * Copies an array and, recursively, the arrays nested in it. Other elements are immutable and shared.
+     */
+    static sptr<IArray> Clone(IArray *array); /* [in] */
+
     static constexpr char SIGNATURE = '[';
 
 private:
@@ -82,7 +104,15 @@ private:
         const std::string &values,                           /* [in] */
         long size);                                          /* [in] */
 
+    using PackedValues = std::variant<std::monostate, std::vector<bool>, std::vector<byte>, std::vector<short>,
+        std::vector<int>, std::vector<long>, std::vector<float>, std::vector<double>, std::vector<std::string>>;
+
+    bool IsPacked() const;
+    bool SetPacked(long index, IInterface *value);
+    void UnpackToBoxed();
+
     std::vector<sptr<IInterface>> values_;
+    PackedValues packed_;
     long size_;
     InterfaceID typeId_;
 
@@ -81,6 +81,13 @@ public:
     static constexpr char SIGNATURE = 'W';
 
 private:
+    friend class WantBinaryCodec;
+
+    /**
+     * @brief Appends the text of ToString() for wantParams to result, nested params are written in place.
+     */
+    static void AppendParams(const WantParams &wantParams, std::string &result);
+
     WantParams wantParams_;
 };
 }  // namespace AAFwk
@@ -15,7 +15,9 @@
 
 #include "array_wrapper.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <type_traits>
 
 #include "bool_wrapper.h"
 #include "zchar_wrapper.h"
@@ -34,6 +36,97 @@ IINTERFACE_IMPL_1(Array, Object, IArray);
 
 constexpr int32_t MAX_ARRAY_SIZE = 50 * 1024 * 1024;
 
+namespace {
+template<typename T>
+struct PackedTraits;
+
+template<>
+struct PackedTraits<bool> {
+    using Boxed = Boolean;
+    using Interface = IBoolean;
+    static const InterfaceID &Id()
+    {
+        return g_IID_IBoolean;
+    }
+};
+
+template<>
+struct PackedTraits<byte> {
+    using Boxed = Byte;
+    using Interface = IByte;
+    static const InterfaceID &Id()
+    {
+        return g_IID_IByte;
+    }
+};
+
+template<>
+struct PackedTraits<short> {
+    using Boxed = Short;
+    using Interface = IShort;
+    static const InterfaceID &Id()
+    {
+        return g_IID_IShort;
+    }
+};
+
+template<>
+struct PackedTraits<int> {
+    using Boxed = Integer;
+    using Interface = IInteger;
+    static const InterfaceID &Id()
+    {
+        return g_IID_IInteger;
+    }
+};
+
+template<>
+struct PackedTraits<long> {
+    using Boxed = Long;
+    using Interface = ILong;
+    static const InterfaceID &Id()
+    {
+        return g_IID_ILong;
+    }
+};
+
+template<>
+struct PackedTraits<float> {
+    using Boxed = Float;
+    using Interface = IFloat;
+    static const InterfaceID &Id()
+    {
+        return g_IID_IFloat;
+    }
+};
+
+template<>
+struct PackedTraits<double> {
+    using Boxed = Double;
+    using Interface = IDouble;
+    static const InterfaceID &Id()
+    {
+        return g_IID_IDouble;
+    }
+};
+
+template<>
+struct PackedTraits<std::string> {
+    using Boxed = String;
+    using Interface = IString;
+    static const InterfaceID &Id()
+    {
+        return g_IID_IString;
+    }
+};
+
+template<typename T>
+using ElementOf = typename std::decay_t<T>::value_type;
+
+template<typename T>
+constexpr bool IS_PACKED_VECTOR = !std::is_same_v<std::decay_t<T>, std::monostate>;
+} // namespace
+
 Array::Array(long size, const InterfaceID &id) : typeId_(id)
 {
     size_ = size > MAX_ARRAY_SIZE ? MAX_ARRAY_SIZE : size;
@@ -49,7 +142,16 @@ ErrCode Array::Get(long index, /* [in] */
         value = nullptr;
         return ERR_INVALID_VALUE;
     }
-    value = values_[index];
+    if (!IsPacked()) {
+        value = values_[index];
+        return ERR_OK;
+    }
+    std::visit([index, &value](const auto &values) {
+        if constexpr (IS_PACKED_VECTOR<decltype(values)>) {
+            using Traits = PackedTraits<ElementOf<decltype(values)>>;
+            value = Traits::Boxed::Box(values[index]);
+        }
+    }, packed_);
     return ERR_OK;
 }
 
@@ -75,10 +177,138 @@ ErrCode Array::Set(long index, /* [in] */
     if (index < 0 || index >= size_) {
         return ERR_INVALID_VALUE;
     }
+    if (IsPacked()) {
+        if (SetPacked(index, value)) {
+            return ERR_OK;
+        }
+        UnpackToBoxed();
+    }
     values_[index] = value;
     return ERR_OK;
 }
 
+bool Array::IsPacked() const
+{
+    return !std::holds_alternative<std::monostate>(packed_);
+}
+
+bool Array::SetPacked(long index, IInterface *value)
+{
+    bool result = false;
+    std::visit([index, value, &result](auto &values) {
+        if constexpr (IS_PACKED_VECTOR<decltype(values)>) {
+            using Traits = PackedTraits<ElementOf<decltype(values)>>;
+            auto typedValue = Traits::Interface::Query(value);
+            if (typedValue != nullptr) {
+                values[index] = Traits::Boxed::Unbox(typedValue);
+                result = true;
+            }
+        }
+    }, packed_);
+    return result;
+}
+
+void Array::UnpackToBoxed()
+{
+    // Elements of another type or null can not be stored unboxed, fall back to one object per element.
+    values_.resize(size_);
+    for (long i = 0; i < size_; i++) {
+        Get(i, values_[i]);
+    }
+    packed_ = std::monostate();
+}
+
+template<typename T>
+sptr<IArray> Array::Pack(std::vector<T> &&values) /* [in] */
+{
+    Array *arrayObj = new (std::nothrow) Array(0, PackedTraits<T>::Id());
+    sptr<IArray> array = arrayObj;
+    if (arrayObj == nullptr) {
+        return nullptr;
+    }
+    if (values.size() > static_cast<size_t>(MAX_ARRAY_SIZE)) {
+        values.resize(MAX_ARRAY_SIZE);
+    }
+    arrayObj->size_ = static_cast<long>(values.size());
+    arrayObj->packed_ = std::move(values);
+    return array;
+}
+
+sptr<IArray> Array::Clone(IArray *array) /* [in] */
+{
+    if (array == nullptr) {
+        return nullptr;
+    }
+    // Array is the only IArray implementation.
+    Array *source = static_cast<Array *>(array);
+    Array *arrayObj = new (std::nothrow) Array(0, source->typeId_);
+    sptr<IArray> result = arrayObj;
+    if (arrayObj == nullptr) {
+        return nullptr;
+    }
+    arrayObj->size_ = source->size_;
+    arrayObj->packed_ = source->packed_;
+    arrayObj->values_.reserve(source->values_.size());
+    for (const auto &value : source->values_) {
+        IArray *nested = value != nullptr ? IArray::Query(value.GetRefPtr()) : nullptr;
+        if (nested == nullptr) {
+            arrayObj->values_.emplace_back(value);
+            continue;
+        }
+        sptr<IArray> nestedCopy = Clone(nested);
+        arrayObj->values_.emplace_back(nestedCopy.GetRefPtr());
+    }
+    return result;
+}
+
+template<typename T>
+bool Array::Unpack(IArray *array, /* [in] */
+    std::vector<T> &values)       /* [out] */
+{
+    if (array == nullptr) {
+        return false;
+    }
+    InterfaceID typeId;
+    array->GetType(typeId);
+    if (typeId != PackedTraits<T>::Id()) {
+        return false;
+    }
+
+    // Array is the only IArray implementation.
+    Array *arrayObj = static_cast<Array *>(array);
+    auto packed = std::get_if<std::vector<T>>(&arrayObj->packed_);
+    if (packed != nullptr) {
+        values = *packed;
+        return true;
+    }
+    values.clear();
+    values.reserve(arrayObj->values_.size());
+    for (const auto &object : arrayObj->values_) {
+        auto typedValue = PackedTraits<T>::Interface::Query(object.GetRefPtr());
+        if (typedValue != nullptr) {
+            values.push_back(PackedTraits<T>::Boxed::Unbox(typedValue));
+        }
+    }
+    return true;
+}
+
+template sptr<IArray> Array::Pack(std::vector<bool> &&values);
+template sptr<IArray> Array::Pack(std::vector<byte> &&values);
+template sptr<IArray> Array::Pack(std::vector<short> &&values);
+template sptr<IArray> Array::Pack(std::vector<int> &&values);
+template sptr<IArray> Array::Pack(std::vector<long> &&values);
+template sptr<IArray> Array::Pack(std::vector<float> &&values);
+template sptr<IArray> Array::Pack(std::vector<double> &&values);
+template sptr<IArray> Array::Pack(std::vector<std::string> &&values);
+template bool Array::Unpack(IArray *array, std::vector<bool> &values);
+template bool Array::Unpack(IArray *array, std::vector<byte> &values);
+template bool Array::Unpack(IArray *array, std::vector<short> &values);
+template bool Array::Unpack(IArray *array, std::vector<int> &values);
+template bool Array::Unpack(IArray *array, std::vector<long> &values);
+template bool Array::Unpack(IArray *array, std::vector<float> &values);
+template bool Array::Unpack(IArray *array, std::vector<double> &values);
+template bool Array::Unpack(IArray *array, std::vector<std::string> &values);
+
 bool Array::Equals(IObject &other) /* [in] */
 {
     Array *otherObj = static_cast<Array *>(IArray::Query(&other));
@@ -98,8 +328,15 @@ bool Array::Equals(IObject &other) /* [in] */
         return false;
     }
 
+    if (IsPacked() && otherObj->IsPacked()) {
+        return packed_ == otherObj->packed_;
+    }
     for (long i = 0; i < size_; i++) {
-        if (!Object::Equals(*(values_[i].GetRefPtr()), *(otherObj->values_[i].GetRefPtr()))) {
+        sptr<IInterface> value;
+        sptr<IInterface> otherValue;
+        Get(i, value);
+        otherObj->Get(i, otherValue);
+        if (!Object::Equals(*(value.GetRefPtr()), *(otherValue.GetRefPtr()))) {
             return false;
         }
     }
@@ -110,6 +347,30 @@ std::string Array::ToString()
 {
     std::string result;
     result = "[";
+    if (IsPacked()) {
+        // Same text as the boxed elements produce, without creating them.
+        std::visit([&result](const auto &values) {
+            if constexpr (IS_PACKED_VECTOR<decltype(values)>) {
+                using Element = ElementOf<decltype(values)>;
+                for (size_t i = 0; i < values.size(); i++) {
+                    if (i > 0) {
+                        result += ",";
+                    }
+                    if constexpr (std::is_same_v<Element, bool>) {
+                        result += values[i] ? "true" : "false";
+                    } else if constexpr (std::is_same_v<Element, std::string>) {
+                        result += "\"";
+                        String::replaceQuotes(values[i], result);
+                        result += "\"";
+                    } else {
+                        result += std::to_string(values[i]);
+                    }
+                }
+            }
+        }, packed_);
+        result += "]";
+        return result;
+    }
     for (long i = 0; i < size_; i++) {
         if (typeId_ == g_IID_IString || typeId_ == g_IID_IChar) {
             result += "\"";
@@ -423,16 +684,12 @@ sptr<IArray> InnerParseString(const nlohmann::json& values)
     if (values.empty()) {
         return nullptr;
     }
-    sptr<IArray> array = new (std::nothrow) Array(values.size(), g_IID_IString);
-    if (array == nullptr) {
-        return nullptr;
-    }
-    int i = 0;
+    std::vector<std::string> array;
+    array.reserve(values.size());
     for (auto& element : values) {
-        array->Set(i, String::Parse(element.get<std::string>()));
-        i++;
+        array.push_back(element.get<std::string>());
     }
-    return array;
+    return Array::Pack(std::move(array));
 }
 
 sptr<IArray> InnerParseLong(const nlohmann::json& values)
@@ -440,16 +697,12 @@ sptr<IArray> InnerParseLong(const nlohmann::json& values)
     if (values.empty()) {
         return nullptr;
     }
-    sptr<IArray> array = new (std::nothrow) Array(values.size(), g_IID_ILong);
-    if (array == nullptr) {
-        return nullptr;
-    }
-    int i = 0;
+    std::vector<long> array;
+    array.reserve(values.size());
     for (auto& element : values) {
-        array->Set(i, Long::Parse(std::to_string(element.get<int64_t>())));
-        i++;
+        array.push_back(static_cast<long>(element.get<int64_t>()));
     }
-    return array;
+    return Array::Pack(std::move(array));
 }
 
 sptr<IArray> InnerParseDouble(const nlohmann::json& values)
@@ -457,16 +710,13 @@ sptr<IArray> InnerParseDouble(const nlohmann::json& values)
     if (values.empty()) {
         return nullptr;
     }
-    sptr<IArray> array = new (std::nothrow) Array(values.size(), g_IID_IDouble);
-    if (array == nullptr) {
-        return nullptr;
-    }
-    int i = 0;
+    std::vector<double> array;
+    array.reserve(values.size());
     for (auto& element : values) {
-        array->Set(i, Double::Parse(std::to_string(element.get<double>())));
-        i++;
+        // Keeps the six decimal rounding of parsing the std::to_string text.
+        array.push_back(std::stod(std::to_string(element.get<double>())));
     }
-    return array;
+    return Array::Pack(std::move(array));
 }
 
 sptr<IArray> InnerParseBoolean(const nlohmann::json& values)
@@ -474,16 +724,12 @@ sptr<IArray> InnerParseBoolean(const nlohmann::json& values)
     if (values.empty()) {
         return nullptr;
     }
-    sptr<IArray> array = new (std::nothrow) Array(values.size(), g_IID_IBoolean);
-    if (array == nullptr) {
-        return nullptr;
-    }
-    int i = 0;
+    std::vector<bool> array;
+    array.reserve(values.size());
     for (auto& element : values) {
-        array->Set(i, Boolean::Parse(element.get<bool>() ? "true" : "false"));
-        i++;
+        array.push_back(element.get<bool>());
     }
-    return array;
+    return Array::Pack(std::move(array));
 }
 } // namespace
 
@@ -38,6 +38,88 @@ size_t FindMatchingBrackets(const std::string &str, size_t leftIndex)
     }
     return -1;
 }
+
+// Parses the text accepted by WantParamWrapper::Parse in a single pass. Nested params are parsed in place
+// instead of from a copy of their text, their closing brace and quote parity are found once up front.
+class WantParamsTextParser final {
+public:
+    explicit WantParamsTextParser(const std::string &str) : str_(str), closingBrace_(str.size(), std::string::npos),
+        oddQuotes_(str.size(), false)
+    {
+        std::vector<std::pair<size_t, size_t>> openBraces;
+        size_t quoteCount = 0;
+        for (size_t i = 0; i < str.size(); i++) {
+            if (str[i] == '"') {
+                quoteCount++;
+            } else if (str[i] == '{') {
+                openBraces.emplace_back(i, quoteCount);
+            } else if (str[i] == '}' && !openBraces.empty()) {
+                closingBrace_[openBraces.back().first] = i;
+                oddQuotes_[openBraces.back().first] = (quoteCount - openBraces.back().second) % 2 != 0;
+                openBraces.pop_back();
+            }
+        }
+    }
+
+    sptr<IWantParams> Parse(size_t begin, size_t end)
+    {
+        WantParams wantParams;
+        std::string key;
+        int typeId = 0;
+        for (size_t pos = begin; pos < end; pos++) {
+            if (str_[pos] == '{' && !key.empty() && typeId == static_cast<int>(WantValueType::VALUE_TYPE_WANTPARAMS)) {
+                size_t close = closingBrace_[pos];
+                if (close == std::string::npos || close >= end) {
+                    wantParams.SetParam(key, WantParamWrapper::Box(WantParams()));
+                    break;
+                }
+                wantParams.SetParam(key, IsValidBlock(pos, close) ? Parse(pos, close + 1) :
+                    WantParamWrapper::Box(WantParams()));
+                key.clear();
+                typeId = 0;
+                pos = close + 1;
+            } else if (str_[pos] == '"') {
+                size_t close = static_cast<size_t>(std::find(str_.begin() + pos + 1, str_.begin() + end, '"') -
+                    str_.begin());
+                if (key.empty()) {
+                    key.assign(str_, pos + 1, close - pos - 1);
+                } else if (typeId == 0) {
+                    typeId = atoi(str_.substr(pos + 1, close - pos - 1).c_str());
+                    if (errno == ERANGE) {
+                        return nullptr;
+                    }
+                } else {
+                    wantParams.SetParam(key, WantParams::GetInterfaceByType(typeId,
+                        str_.substr(pos + 1, close - pos - 1)));
+                    typeId = 0;
+                    key.clear();
+                }
+                pos = close;
+            }
+        }
+        sptr<IWantParams> iwantParams = new (std::nothrow) WantParamWrapper(std::move(wantParams));
+        return iwantParams;
+    }
+
+private:
+    // Same checks as WantParamWrapper::ValidateStr for the block between two matching braces.
+    bool IsValidBlock(size_t open, size_t close) const
+    {
+        size_t length = close - open + 1;
+        if (length == EMPTY_BLOCK_SIZE ||
+            (length == EMPTY_KEY_BLOCK_SIZE && str_.compare(open, length, "{\"\"}") == 0)) {
+            return false;
+        }
+        return !oddQuotes_[open];
+    }
+
+    static constexpr size_t EMPTY_BLOCK_SIZE = 2;
+    static constexpr size_t EMPTY_KEY_BLOCK_SIZE = 4;
+
+    const std::string &str_;
+    std::vector<size_t> closingBrace_;
+    std::vector<bool> oddQuotes_;
+};
 }
 constexpr int32_t WANT_PARAM_WRAPPER_TWO = 2;
 
@@ -60,21 +142,30 @@ bool WantParamWrapper::Equals(IObject &other)
 std::string WantParamWrapper::ToString()
 {
     std::string result;
-    if (wantParams_.Size() == 0) {
-        return "[]";
+    AppendParams(wantParams_, result);
+    return result;
+}
+
+void WantParamWrapper::AppendParams(const WantParams &wantParams, std::string &result)
+{
+    if (wantParams.Size() == 0) {
+        result += "[]";
+        return;
     }
     result += "[";
-    for (auto it : wantParams_.GetParams()) {
-        int typeId = WantParams::GetDataType(it.second);
-        result = result + "{\"" + JSON_WANTPARAMS_KEY + "\":\"" + it.first + "\",\"" + JSON_WANTPARAMS_TYPE + "\":";
+    const auto &params = wantParams.GetSortedParams();
+    for (const auto &param : params) {
+        int typeId = param.type;
+        result.append("{\"").append(JSON_WANTPARAMS_KEY).append("\":\"").append(param.key);
+        result.append("\",\"").append(JSON_WANTPARAMS_TYPE).append("\":");
         if (typeId > TYPEID_TRANSFORM_START && typeId < TYPEID_TRANSFORM_END) {
-            result = result + std::to_string(typeId + 1);
+            result += std::to_string(typeId + 1);
         } else {
-            result = result + std::to_string(typeId);
+            result += std::to_string(typeId);
         }
-        result = result + ",\"" + JSON_WANTPARAMS_VALUE + "\":";
-        if (IWantParams::Query(it.second) != nullptr) {
-            result = result + static_cast<WantParamWrapper*>(IWantParams::Query(it.second))->ToString();
+        result.append(",\"").append(JSON_WANTPARAMS_VALUE).append("\":");
+        if (typeId == WantParams::VALUE_TYPE_WANTPARAMS) {
+            AppendParams(static_cast<WantParamWrapper*>(IWantParams::Query(param.value))->wantParams_, result);
         } else {
             if (typeId == static_cast<int>(OHOS::AAFwk::WantValueType::VALUE_TYPE_ARRAY) ||
                 typeId == static_cast<int>(OHOS::AAFwk::WantValueType::VALUE_TYPE_SHORT) ||
@@ -84,19 +175,18 @@ std::string WantParamWrapper::ToString()
                 typeId == static_cast<int>(OHOS::AAFwk::WantValueType::VALUE_TYPE_LONG) ||
                 typeId == (static_cast<int>(OHOS::AAFwk::WantValueType::VALUE_TYPE_FLOAT) - 1) ||
                 typeId == (static_cast<int>(OHOS::AAFwk::WantValueType::VALUE_TYPE_DOUBLE) - 1)) {
-                result = result + WantParams::GetStringByType(it.second, typeId);
+                result += WantParams::GetStringByType(param.value, typeId);
             } else {
-                result = result + "\"" + WantParams::GetStringByType(it.second, typeId) + "\"";
+                result.append("\"").append(WantParams::GetStringByType(param.value, typeId)).append("\"");
             }
         }
-        if (it == *wantParams_.GetParams().rbegin()) {
+        if (&param == &params.back()) {
             result += "}";
         } else {
             result += "},";
         }
     }
     result += "]";
-    return result;
 }
 
 sptr<IWantParams> WantParamWrapper::Box(const WantParams &value)
@@ -147,53 +237,12 @@ bool WantParamWrapper::ValidateStr(const std::string &str)
 
 sptr<IWantParams> WantParamWrapper::Parse(const std::string &str)
 {
-    WantParams wantPaqrams;
-    std::string key = "";
-    if (ValidateStr(str)) {
-        int typeId = 0;
-        for (size_t strnum = 0; strnum < str.size(); strnum++) {
-            if (str[strnum] == '{' && key != "" && typeId == WantParams::VALUE_TYPE_WANTPARAMS) {
-                size_t num;
-                int count = 0;
-                for (num = strnum; num < str.size(); num++) {
-                    if (str[num] == '{') {
-                        count++;
-                    } else if (str[num] == '}') {
-                        count--;
-                    }
-                    if (count == 0) {
-                        break;
-                    }
-                }
-                wantPaqrams.SetParam(key, WantParamWrapper::Parse(str.substr(strnum, num - strnum + 1)));
-                key = "";
-                typeId = 0;
-                strnum = num + 1;
-            } else if (str[strnum] == '"') {
-                if (key == "") {
-                    strnum++;
-                    key = str.substr(strnum, str.find('"', strnum) - strnum);
-                    strnum = str.find('"', strnum);
-                } else if (typeId == 0) {
-                    strnum++;
-                    typeId = atoi(str.substr(strnum, str.find('"', strnum) - strnum).c_str());
-                    if (errno == ERANGE) {
-                        return nullptr;
-                    }
-                    strnum = str.find('"', strnum);
-                } else {
-                    strnum++;
-                    wantPaqrams.SetParam(key,
-                        WantParams::GetInterfaceByType(typeId, str.substr(strnum, str.find('"', strnum) - strnum)));
-                    strnum = str.find('"', strnum);
-                    typeId = 0;
-                    key = "";
-                }
-            }
-        }
+    if (!ValidateStr(str)) {
+        sptr<IWantParams> iwantParams = new (std::nothrow) WantParamWrapper(WantParams());
+        return iwantParams;
     }
-    sptr<IWantParams> iwantParams = new (std::nothrow) WantParamWrapper(wantPaqrams);
-    return iwantParams;
+    WantParamsTextParser parser(str);
+    return parser.Parse(0, str.size());
 }
 
 WantParams WantParamWrapper::ParseWantParams(const std::string &str)
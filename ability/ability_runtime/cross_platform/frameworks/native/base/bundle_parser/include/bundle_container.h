@@ -18,8 +18,12 @@
 
 #include <functional>
 #include <list>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
+#include <utility>
 
 #include "application_info.h"
 #include "bundle_constants.h"
@@ -35,6 +39,8 @@ public:
 
 public:
     void LoadBundleInfos(const std::list<std::vector<uint8_t>>& bufList);
+    void LoadModuleInfo(const InnerBundleInfo& moduleInfo);
+    bool HasModuleInfo(const std::string& modulePackage) const;
     std::shared_ptr<ApplicationInfo> GetApplicationInfo() const;
     std::shared_ptr<BundleInfo> GetBundleInfo() const;
     std::shared_ptr<BundleInfo> GetBundleInfoV9(int32_t flag) const;
@@ -42,6 +48,14 @@ public:
     void RemoveModuleInfo(const std::string& modulePackage);
     std::shared_ptr<AbilityInfo> GetAbilityInfo(const std::string& moduleName, const std::string& abilityName) const;
     std::vector<std::shared_ptr<AbilityInfo>> GetAbilityInfos() const;
+    // Shared read-only views, built on first use and dropped whenever the bundle changes. The getters above
+    // return mutable copies of them.
+    std::shared_ptr<const ApplicationInfo> GetApplicationInfoSnapshot() const;
+    std::shared_ptr<const BundleInfo> GetBundleInfoSnapshot() const;
+    std::shared_ptr<const BundleInfo> GetBundleInfoV9Snapshot(int32_t flag) const;
+    std::shared_ptr<const HapModuleInfo> GetHapModuleInfoSnapshot(const std::string& modulePackage) const;
+    std::shared_ptr<const AbilityInfo> GetAbilityInfoSnapshot(
+        const std::string& moduleName, const std::string& abilityName) const;
     void dump(const std::string& pathName);
     void SetAppCodePath(const std::string& codePath);
     void SetBundleName(const std::string& bundleName);
@@ -50,7 +64,22 @@ public:
     ErrCode GetBundleInfoForSelf(int32_t flags, BundleInfo& bundleInfo);
 
 private:
+    void InvalidateSnapshots();
+    // Build a fresh info from bundleInfo_, called with snapshotMutex_ held.
+    std::shared_ptr<ApplicationInfo> BuildApplicationInfo() const;
+    std::shared_ptr<BundleInfo> BuildBundleInfo() const;
+    std::shared_ptr<BundleInfo> BuildBundleInfoV9(int32_t flag) const;
+    std::shared_ptr<HapModuleInfo> BuildHapModuleInfo(const std::string& modulePackage) const;
+    std::shared_ptr<AbilityInfo> BuildAbilityInfo(const std::string& moduleName, const std::string& abilityName) const;
+
     std::shared_ptr<InnerBundleInfo> bundleInfo_ = nullptr;
+
+    mutable std::mutex snapshotMutex_;
+    mutable std::shared_ptr<const ApplicationInfo> applicationInfoSnapshot_;
+    mutable std::shared_ptr<const BundleInfo> bundleInfoSnapshot_;
+    mutable std::map<int32_t, std::shared_ptr<const BundleInfo>> bundleInfoV9Snapshots_;
+    mutable std::map<std::string, std::shared_ptr<const HapModuleInfo>> hapModuleInfoSnapshots_;
+    mutable std::map<std::pair<std::string, std::string>, std::shared_ptr<const AbilityInfo>> abilityInfoSnapshots_;
 };
 } // namespace AppExecFwk
 } // namespace OHOS
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_APPEXECFWK_SERVICES_BUNDLEMGR_INCLUDE_HSP_MODULE_JSON_CACHE_H
+#define FOUNDATION_APPEXECFWK_SERVICES_BUNDLEMGR_INCLUDE_HSP_MODULE_JSON_CACHE_H
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "inner_bundle_info.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+/**
+ * Process wide cache of parsed HSP module.json files, keyed by file path and validated by the
+ * modification time and size of the file, so a shared package is only parsed again after it changed.
+ */
+class HspModuleJsonCache {
+public:
+    using BufferLoader = std::function<std::vector<uint8_t>(const std::string&)>;
+
+    static HspModuleJsonCache& GetInstance();
+
+    std::shared_ptr<const InnerBundleInfo> GetModuleInfo(const std::string& jsonPath, const BufferLoader& loader);
+    void Invalidate(const std::string& jsonPath);
+    void Clear();
+
+private:
+    HspModuleJsonCache() = default;
+    ~HspModuleJsonCache() = default;
+
+    struct CacheEntry {
+        int64_t modifyTime = 0;
+        int64_t fileSize = 0;
+        std::shared_ptr<const InnerBundleInfo> moduleInfo;
+    };
+
+    std::mutex mutex_;
+    std::unordered_map<std::string, CacheEntry> entries_;
+};
+} // namespace AppExecFwk
+} // namespace OHOS
+#endif // FOUNDATION_APPEXECFWK_SERVICES_BUNDLEMGR_INCLUDE_HSP_MODULE_JSON_CACHE_H
@@ -25,6 +25,8 @@
 #include "json_util.h"
 // #include "nocopyable.h"
 
+#include <unordered_map>
+
 namespace OHOS {
 namespace AppExecFwk {
 struct Distro {
@@ -184,12 +186,24 @@ public:
      * @return Returns true if the module successfully added; returns false otherwise.
      */
     bool AddModuleInfo(const InnerBundleInfo& newInfo);
+    /**
+     * @brief Add module info to old InnerBundleInfo object, moving the module entries out of newInfo.
+     * @param newInfo Indicates the new InnerBundleInfo object, left untouched when false is returned.
+     * @return Returns true if the module successfully added; returns false otherwise.
+     */
+    bool AddModuleInfo(InnerBundleInfo&& newInfo);
     /**
      * @brief Update module info to old InnerBundleInfo object.
      * @param newInfo Indicates the new InnerBundleInfo object.
      * @return
      */
     void UpdateModuleInfo(const InnerBundleInfo& newInfo);
+    /**
+     * @brief Update module info to old InnerBundleInfo object, moving the module entries out of newInfo.
+     * @param newInfo Indicates the new InnerBundleInfo object.
+     * @return
+     */
+    void UpdateModuleInfo(InnerBundleInfo&& newInfo);
     /**
      * @brief Remove module info from InnerBundleInfo object.
      * @param modulePackage Indicates the module package to be remove.
@@ -255,7 +269,18 @@ public:
     void AddModuleAbilityInfo(const std::map<std::string, AbilityInfo>& abilityInfos)
     {
         for (const auto& ability : abilityInfos) {
-            baseAbilityInfos_.try_emplace(ability.first, ability.second);
+            if (baseAbilityInfos_.try_emplace(ability.first, ability.second).second) {
+                IndexAbilityInfo(ability.first, ability.second);
+            }
+        }
+    }
+    void AddModuleAbilityInfo(std::map<std::string, AbilityInfo>&& abilityInfos)
+    {
+        for (auto& ability : abilityInfos) {
+            auto result = baseAbilityInfos_.try_emplace(ability.first, std::move(ability.second));
+            if (result.second) {
+                IndexAbilityInfo(result.first->first, result.first->second);
+            }
         }
     }
 
@@ -276,6 +301,18 @@ public:
             extensionSkillInfos_.try_emplace(skills.first, skills.second);
         }
     }
+    void AddModuleSkillInfo(std::map<std::string, std::vector<Skill>>&& skillInfos)
+    {
+        for (auto& skills : skillInfos) {
+            skillInfos_.try_emplace(skills.first, std::move(skills.second));
+        }
+    }
+    void AddModuleExtensionSkillInfos(std::map<std::string, std::vector<Skill>>&& extensionSkillInfos)
+    {
+        for (auto& skills : extensionSkillInfos) {
+            extensionSkillInfos_.try_emplace(skills.first, std::move(skills.second));
+        }
+    }
 
     /**
      * @brief Add innerModuleInfos to old InnerBundleInfo object.
@@ -285,7 +322,18 @@ public:
     void AddInnerModuleInfo(const std::map<std::string, InnerModuleInfo>& innerModuleInfos)
     {
         for (const auto& info : innerModuleInfos) {
-            innerModuleInfos_.try_emplace(info.first, info.second);
+            if (innerModuleInfos_.try_emplace(info.first, info.second).second) {
+                IndexInnerModuleInfo(info.first, info.second);
+            }
+        }
+    }
+    void AddInnerModuleInfo(std::map<std::string, InnerModuleInfo>&& innerModuleInfos)
+    {
+        for (auto& info : innerModuleInfos) {
+            auto result = innerModuleInfos_.try_emplace(info.first, std::move(info.second));
+            if (result.second) {
+                IndexInnerModuleInfo(result.first->first, result.first->second);
+            }
         }
     }
     /**
@@ -480,7 +528,9 @@ public:
      */
     void InsertInnerModuleInfo(const std::string& modulePackage, const InnerModuleInfo& innerModuleInfo)
     {
-        innerModuleInfos_.try_emplace(modulePackage, innerModuleInfo);
+        if (innerModuleInfos_.try_emplace(modulePackage, innerModuleInfo).second) {
+            IndexInnerModuleInfo(modulePackage, innerModuleInfo);
+        }
     }
     /**
      * @brief Insert AbilityInfo.
@@ -489,7 +539,9 @@ public:
      */
     void InsertAbilitiesInfo(const std::string& key, const AbilityInfo& abilityInfo)
     {
-        baseAbilityInfos_.emplace(key, abilityInfo);
+        if (baseAbilityInfos_.emplace(key, abilityInfo).second) {
+            IndexAbilityInfo(key, abilityInfo);
+        }
     }
 
     /**
@@ -1080,14 +1132,14 @@ public:
         return innerModuleInfos_;
     }
     /**
-     * @brief Fetch all innerModuleInfos, can be modify.
+     * @brief Fetch all innerModuleInfos, can be modify. The module names must not be changed.
      */
     std::map<std::string, InnerModuleInfo>& FetchInnerModuleInfos()
     {
         return innerModuleInfos_;
     }
     /**
-     * @brief Fetch all abilityInfos, can be modify.
+     * @brief Fetch all abilityInfos, can be modify. The module and ability names must not be changed.
      */
     std::map<std::string, AbilityInfo>& FetchAbilityInfos()
     {
@@ -1596,6 +1648,11 @@ public:
     void ResetApplyQuickFixFrequency();
 
 private:
+    void IndexInnerModuleInfo(const std::string& modulePackage, const InnerModuleInfo& innerModuleInfo);
+    void IndexAbilityInfo(const std::string& key, const AbilityInfo& abilityInfo);
+    void RebuildIndexes();
+    const InnerModuleInfo* FindInnerModuleInfo(const std::string& moduleName) const;
+    const AbilityInfo* FindIndexedAbilityInfo(const std::string& moduleName, const std::string& abilityName) const;
     void RemoveDuplicateName(std::vector<std::string>& name) const;
     void GetBundleWithReqPermissionsV9(int32_t flags, uint32_t userId, BundleInfo& bundleInfo) const;
     void ProcessBundleFlags(int32_t flags, int32_t userId, BundleInfo& bundleInfo) const;
@@ -1625,6 +1682,11 @@ private:
     std::map<std::string, AbilityInfo> baseAbilityInfos_;
     std::map<std::string, std::vector<Skill>> skillInfos_;
 
+    // moduleName -> modulePackage and moduleName -> abilityName -> ability key. The values are keys of the maps
+    // above, so the indexes stay valid when this object is copied. On duplicates the first key in map order wins.
+    std::unordered_map<std::string, std::string> moduleNameIndex_;
+    std::unordered_map<std::string, std::unordered_map<std::string, std::string>> abilityIndex_;
+
     std::map<std::string, InnerBundleUserInfo> innerBundleUserInfos_;
 
     bool isNewVersion_ = false;
@@ -42,10 +42,9 @@ enum class ArrayType {
 };
 
 template<typename T, typename dataType>
-void CheckArrayType(
-    const nlohmann::json& jsonObject, const std::string& key, dataType& data, ArrayType arrayType, int32_t& parseResult)
+void CheckArrayValue(
+    const nlohmann::json& arrays, const std::string& key, dataType& data, ArrayType arrayType, int32_t& parseResult)
 {
-    auto arrays = jsonObject.at(key);
     if (arrays.empty()) {
         return;
     }
@@ -62,7 +61,7 @@ void CheckArrayType(
                 }
             }
             if (parseResult == ERR_OK) {
-                data = jsonObject.at(key).get<T>();
+                data = arrays.get<T>();
             }
             break;
         case ArrayType::OBJECT:
@@ -74,7 +73,7 @@ void CheckArrayType(
                 }
             }
             if (parseResult == ERR_OK) {
-                data = jsonObject.at(key).get<T>();
+                data = arrays.get<T>();
             }
             break;
         case ArrayType::NUMBER:
@@ -85,7 +84,7 @@ void CheckArrayType(
                 }
             }
             if (parseResult == ERR_OK) {
-                data = jsonObject.at(key).get<T>();
+                data = arrays.get<T>();
             }
             break;
         case ArrayType::NOT_ARRAY:
@@ -97,6 +96,14 @@ void CheckArrayType(
     }
 }
 
+template<typename T, typename dataType>
+void CheckArrayType(
+    const nlohmann::json& jsonObject, const std::string& key, dataType& data, ArrayType arrayType, int32_t& parseResult)
+{
+    CheckArrayValue<T>(jsonObject.at(key), key, data, arrayType, parseResult);
+}
+
+// Looks the key up once, the value is validated in place and converted straight into data.
 template<typename T, typename dataType>
 void GetValueIfFindKey(const nlohmann::json& jsonObject, const nlohmann::detail::iter_impl<const nlohmann::json>& end,
     const std::string& key, dataType& data, JsonType jsonType, bool isNecessary, int32_t& parseResult,
@@ -105,48 +112,50 @@ void GetValueIfFindKey(const nlohmann::json& jsonObject, const nlohmann::detail:
     if (parseResult) {
         return;
     }
-    if (jsonObject.find(key) != end) {
+    auto iter = jsonObject.find(key);
+    if (iter != end) {
+        const nlohmann::json& value = *iter;
         switch (jsonType) {
             case JsonType::BOOLEAN:
-                if (!jsonObject.at(key).is_boolean()) {
+                if (!value.is_boolean()) {
                     HILOG_ERROR("type is error %{public}s is not boolean", key.c_str());
                     parseResult = ERR_APPEXECFWK_PARSE_PROFILE_PROP_TYPE_ERROR;
                     break;
                 }
-                data = jsonObject.at(key).get<T>();
+                data = value.get<T>();
                 break;
             case JsonType::NUMBER:
-                if (!jsonObject.at(key).is_number()) {
+                if (!value.is_number()) {
                     HILOG_ERROR("type is error %{public}s is not number", key.c_str());
                     parseResult = ERR_APPEXECFWK_PARSE_PROFILE_PROP_TYPE_ERROR;
                     break;
                 }
-                data = jsonObject.at(key).get<T>();
+                data = value.get<T>();
                 break;
             case JsonType::OBJECT:
-                if (!jsonObject.at(key).is_object()) {
+                if (!value.is_object()) {
                     HILOG_ERROR("type is error %{public}s is not object", key.c_str());
                     parseResult = ERR_APPEXECFWK_PARSE_PROFILE_PROP_TYPE_ERROR;
                     break;
                 }
-                data = jsonObject.at(key).get<T>();
+                data = value.get<T>();
                 break;
             case JsonType::ARRAY:
-                if (!jsonObject.at(key).is_array()) {
+                if (!value.is_array()) {
                     HILOG_ERROR("type is error %{public}s is not array", key.c_str());
                     parseResult = ERR_APPEXECFWK_PARSE_PROFILE_PROP_TYPE_ERROR;
                     break;
                 }
-                CheckArrayType<T>(jsonObject, key, data, arrayType, parseResult);
+                CheckArrayValue<T>(value, key, data, arrayType, parseResult);
                 break;
             case JsonType::STRING:
-                if (!jsonObject.at(key).is_string()) {
+                if (!value.is_string()) {
                     HILOG_ERROR("type is error %{public}s is not string", key.c_str());
                     parseResult = ERR_APPEXECFWK_PARSE_PROFILE_PROP_TYPE_ERROR;
                     break;
                 }
-                data = jsonObject.at(key).get<T>();
-                if (jsonObject.at(key).get<std::string>().length() > Constants::MAX_JSON_ELEMENT_LENGTH) {
+                data = value.get<T>();
+                if (value.get_ref<const std::string&>().length() > Constants::MAX_JSON_ELEMENT_LENGTH) {
                     parseResult = ERR_APPEXECFWK_PARSE_PROFILE_PROP_SIZE_CHECK_ERROR;
                 }
                 break;
@@ -15,7 +15,10 @@
 
 #include "bundle_container.h"
 
+#include <algorithm>
+#include <atomic>
 #include <fstream>
+#include <thread>
 #include <nlohmann/json.hpp>
 
 #include "bundle_parser.h"
@@ -26,105 +29,275 @@
 
 namespace OHOS {
 namespace AppExecFwk {
+namespace {
+constexpr size_t MAX_PARSE_WORKERS = 4;
+// Below this many modules, starting threads costs more than parsing the buffers serially.
+constexpr size_t MIN_PARALLEL_PARSE_MODULES = 4;
+} // namespace
+
 BundleContainer::BundleContainer() {}
 
 BundleContainer::~BundleContainer() {}
 
 void BundleContainer::LoadBundleInfos(const std::list<std::vector<uint8_t>>& bufList)
 {
-    BundleParser parser;
     HILOG_INFO("BundleContainer LoadBundleInfos bufList size %{public}d", static_cast<int>(bufList.size()));
-    for (auto it = bufList.begin(); it != bufList.end(); it++) {
-        InnerBundleInfo bInfo;
-        if (parser.Parse(*it, bInfo) != ERR_OK) {
+    std::vector<const std::vector<uint8_t>*> buffers;
+    buffers.reserve(bufList.size());
+    for (const auto& buf : bufList) {
+        buffers.emplace_back(&buf);
+    }
+
+    // Each buffer is parsed into its own slot, a failed parse leaves the slot empty.
+    std::vector<std::shared_ptr<InnerBundleInfo>> moduleInfos(buffers.size());
+    std::atomic<size_t> nextIndex { 0 };
+    auto parseTask = [&buffers, &moduleInfos, &nextIndex]() {
+        BundleParser parser;
+        for (size_t index = nextIndex++; index < buffers.size(); index = nextIndex++) {
+            auto moduleInfo = std::make_shared<InnerBundleInfo>();
+            if (parser.Parse(*buffers[index], *moduleInfo) == ERR_OK) {
+                moduleInfos[index] = std::move(moduleInfo);
+            }
+        }
+    };
+    // The calling thread parses as well, small applications never start a worker.
+    size_t workerCount = 1;
+    if (buffers.size() >= MIN_PARALLEL_PARSE_MODULES) {
+        size_t hardwareThreads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        workerCount = std::min({ MAX_PARSE_WORKERS, hardwareThreads, buffers.size() });
+    }
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < workerCount; ++i) {
+        workers.emplace_back(parseTask);
+    }
+    parseTask();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    // Merging follows the order of bufList, so the result does not depend on which worker finished first.
+    for (auto& moduleInfo : moduleInfos) {
+        if (moduleInfo == nullptr) {
             continue;
         }
         if (bundleInfo_ == nullptr) {
-            bundleInfo_ = std::make_shared<InnerBundleInfo>();
-            *bundleInfo_ = bInfo;
-        } else {
-            bool added = bundleInfo_->AddModuleInfo(bInfo);
-            if (!added) {
-                bundleInfo_->UpdateModuleInfo(bInfo);
-            }
+            bundleInfo_ = std::move(moduleInfo);
+        } else if (!bundleInfo_->AddModuleInfo(std::move(*moduleInfo))) {
+            bundleInfo_->UpdateModuleInfo(std::move(*moduleInfo));
         }
     }
+    InvalidateSnapshots();
 }
 
+void BundleContainer::LoadModuleInfo(const InnerBundleInfo& moduleInfo)
+{
+    if (bundleInfo_ == nullptr) {
+        bundleInfo_ = std::make_shared<InnerBundleInfo>();
+        *bundleInfo_ = moduleInfo;
+    } else if (!bundleInfo_->AddModuleInfo(moduleInfo)) {
+        bundleInfo_->UpdateModuleInfo(moduleInfo);
+    }
+    InvalidateSnapshots();
+}
+
+bool BundleContainer::HasModuleInfo(const std::string& modulePackage) const
+{
+    return bundleInfo_ != nullptr && bundleInfo_->FindModule(modulePackage);
+}
+
+// The mutable getters copy a cached snapshot, or build the info straight into the object they return.
 std::shared_ptr<ApplicationInfo> BundleContainer::GetApplicationInfo() const
 {
-    if (bundleInfo_ != nullptr) {
-        auto appInfo = std::make_shared<ApplicationInfo>();
-        bundleInfo_->GetApplicationInfo(0, Constants::UNSPECIFIED_USERID, *appInfo);
-        return appInfo;
+    std::lock_guard<std::mutex> lock(snapshotMutex_);
+    if (applicationInfoSnapshot_ != nullptr) {
+        return std::make_shared<ApplicationInfo>(*applicationInfoSnapshot_);
     }
-    return nullptr;
+    return BuildApplicationInfo();
 }
 
 std::shared_ptr<BundleInfo> BundleContainer::GetBundleInfo() const
 {
-    if (bundleInfo_ != nullptr) {
-        auto bInfo = std::make_shared<BundleInfo>();
-        auto flag = static_cast<int32_t>(GetBundleInfoFlag::GET_BUNDLE_INFO_WITH_HAP_MODULE);
-        auto uid = Constants::UNSPECIFIED_USERID;
-        if (bundleInfo_->GetBundleInfo(flag, *bInfo, uid)) {
-            return bInfo;
-        }
+    std::lock_guard<std::mutex> lock(snapshotMutex_);
+    if (bundleInfoSnapshot_ != nullptr) {
+        return std::make_shared<BundleInfo>(*bundleInfoSnapshot_);
     }
-    return nullptr;
+    return BuildBundleInfo();
 }
 
 std::shared_ptr<BundleInfo> BundleContainer::GetBundleInfoV9(int32_t flag) const
 {
-    HILOG_INFO("BundleContainer GetBundleInfoV9 flag %{public}d", flag);
-    if (bundleInfo_ != nullptr) {
-        auto bInfo = std::make_shared<BundleInfo>();
-        if (bInfo == nullptr) {
-            return nullptr;
-        }
-        auto uid = Constants::UNSPECIFIED_USERID;
-        if (bundleInfo_->GetBundleInfoV9(flag, *bInfo, uid) == ERR_OK) {
-            return bInfo;
-        }
+    std::lock_guard<std::mutex> lock(snapshotMutex_);
+    auto iter = bundleInfoV9Snapshots_.find(flag);
+    if (iter != bundleInfoV9Snapshots_.end()) {
+        return std::make_shared<BundleInfo>(*iter->second);
     }
-    return nullptr;
+    return BuildBundleInfoV9(flag);
 }
 
 std::shared_ptr<HapModuleInfo> BundleContainer::GetHapModuleInfo(const std::string& modulePackage) const
 {
-    if (bundleInfo_ != nullptr) {
-        auto uid = Constants::UNSPECIFIED_USERID;
-        HILOG_INFO("BundleContainer GetHapModuleInfo by modulePackage %{public}s", modulePackage.c_str());
-        std::optional<HapModuleInfo> hapMouduleInfo = bundleInfo_->FindHapModuleInfo(modulePackage, uid);
-        if (hapMouduleInfo) {
-            auto hapInfo = std::make_shared<HapModuleInfo>();
-            *hapInfo = *hapMouduleInfo;
-            return hapInfo;
-        }
+    std::lock_guard<std::mutex> lock(snapshotMutex_);
+    auto iter = hapModuleInfoSnapshots_.find(modulePackage);
+    if (iter != hapModuleInfoSnapshots_.end()) {
+        return std::make_shared<HapModuleInfo>(*iter->second);
     }
-    return nullptr;
+    return BuildHapModuleInfo(modulePackage);
 }
 
 void BundleContainer::RemoveModuleInfo(const std::string& modulePackage)
 {
     if (bundleInfo_ != nullptr) {
         bundleInfo_->RemoveModuleInfo(modulePackage);
+        InvalidateSnapshots();
     }
 }
 
 std::shared_ptr<AbilityInfo> BundleContainer::GetAbilityInfo(
     const std::string& moduleName, const std::string& abilityName) const
 {
-    if (bundleInfo_ != nullptr) {
-        auto uid = Constants::UNSPECIFIED_USERID;
-        std::optional<AbilityInfo> ablilityInfo = bundleInfo_->FindAbilityInfo(moduleName, abilityName, uid);
-        if (ablilityInfo) {
-            auto aInfo = std::make_shared<AbilityInfo>();
-            *aInfo = *ablilityInfo;
-            return aInfo;
-        }
+    std::lock_guard<std::mutex> lock(snapshotMutex_);
+    auto iter = abilityInfoSnapshots_.find(std::make_pair(moduleName, abilityName));
+    if (iter != abilityInfoSnapshots_.end()) {
+        return std::make_shared<AbilityInfo>(*iter->second);
+    }
+    return BuildAbilityInfo(moduleName, abilityName);
+}
+
+std::shared_ptr<const ApplicationInfo> BundleContainer::GetApplicationInfoSnapshot() const
+{
+    std::lock_guard<std::mutex> lock(snapshotMutex_);
+    if (applicationInfoSnapshot_ == nullptr) {
+        applicationInfoSnapshot_ = BuildApplicationInfo();
+    }
+    return applicationInfoSnapshot_;
+}
+
+std::shared_ptr<const BundleInfo> BundleContainer::GetBundleInfoSnapshot() const
+{
+    std::lock_guard<std::mutex> lock(snapshotMutex_);
+    if (bundleInfoSnapshot_ == nullptr) {
+        bundleInfoSnapshot_ = BuildBundleInfo();
+    }
+    return bundleInfoSnapshot_;
+}
+
+std::shared_ptr<const BundleInfo> BundleContainer::GetBundleInfoV9Snapshot(int32_t flag) const
+{
+    std::lock_guard<std::mutex> lock(snapshotMutex_);
+    auto iter = bundleInfoV9Snapshots_.find(flag);
+    if (iter != bundleInfoV9Snapshots_.end()) {
+        return iter->second;
     }
-    return nullptr;
+    std::shared_ptr<const BundleInfo> bInfo = BuildBundleInfoV9(flag);
+    if (bInfo != nullptr) {
+        bundleInfoV9Snapshots_.emplace(flag, bInfo);
+    }
+    return bInfo;
+}
+
+std::shared_ptr<const HapModuleInfo> BundleContainer::GetHapModuleInfoSnapshot(const std::string& modulePackage) const
+{
+    std::lock_guard<std::mutex> lock(snapshotMutex_);
+    auto iter = hapModuleInfoSnapshots_.find(modulePackage);
+    if (iter != hapModuleInfoSnapshots_.end()) {
+        return iter->second;
+    }
+    std::shared_ptr<const HapModuleInfo> hapInfo = BuildHapModuleInfo(modulePackage);
+    if (hapInfo != nullptr) {
+        hapModuleInfoSnapshots_.emplace(modulePackage, hapInfo);
+    }
+    return hapInfo;
+}
+
+std::shared_ptr<const AbilityInfo> BundleContainer::GetAbilityInfoSnapshot(
+    const std::string& moduleName, const std::string& abilityName) const
+{
+    std::lock_guard<std::mutex> lock(snapshotMutex_);
+    auto key = std::make_pair(moduleName, abilityName);
+    auto iter = abilityInfoSnapshots_.find(key);
+    if (iter != abilityInfoSnapshots_.end()) {
+        return iter->second;
+    }
+    std::shared_ptr<const AbilityInfo> aInfo = BuildAbilityInfo(moduleName, abilityName);
+    if (aInfo != nullptr) {
+        abilityInfoSnapshots_.emplace(std::move(key), aInfo);
+    }
+    return aInfo;
+}
+
+std::shared_ptr<ApplicationInfo> BundleContainer::BuildApplicationInfo() const
+{
+    if (bundleInfo_ == nullptr) {
+        return nullptr;
+    }
+    auto appInfo = std::make_shared<ApplicationInfo>();
+    bundleInfo_->GetApplicationInfo(0, Constants::UNSPECIFIED_USERID, *appInfo);
+    return appInfo;
+}
+
+std::shared_ptr<BundleInfo> BundleContainer::BuildBundleInfo() const
+{
+    if (bundleInfo_ == nullptr) {
+        return nullptr;
+    }
+    auto bInfo = std::make_shared<BundleInfo>();
+    auto flag = static_cast<int32_t>(GetBundleInfoFlag::GET_BUNDLE_INFO_WITH_HAP_MODULE);
+    auto uid = Constants::UNSPECIFIED_USERID;
+    if (!bundleInfo_->GetBundleInfo(flag, *bInfo, uid)) {
+        return nullptr;
+    }
+    return bInfo;
+}
+
+std::shared_ptr<BundleInfo> BundleContainer::BuildBundleInfoV9(int32_t flag) const
+{
+    if (bundleInfo_ == nullptr) {
+        return nullptr;
+    }
+    auto bInfo = std::make_shared<BundleInfo>();
+    auto uid = Constants::UNSPECIFIED_USERID;
+    if (bundleInfo_->GetBundleInfoV9(flag, *bInfo, uid) != ERR_OK) {
+        return nullptr;
+    }
+    return bInfo;
+}
+
+std::shared_ptr<HapModuleInfo> BundleContainer::BuildHapModuleInfo(const std::string& modulePackage) const
+{
+    if (bundleInfo_ == nullptr) {
+        return nullptr;
+    }
+    auto uid = Constants::UNSPECIFIED_USERID;
+    HILOG_INFO("BundleContainer GetHapModuleInfo by modulePackage %{public}s", modulePackage.c_str());
+    std::optional<HapModuleInfo> hapMouduleInfo = bundleInfo_->FindHapModuleInfo(modulePackage, uid);
+    if (!hapMouduleInfo) {
+        return nullptr;
+    }
+    return std::make_shared<HapModuleInfo>(std::move(*hapMouduleInfo));
+}
+
+std::shared_ptr<AbilityInfo> BundleContainer::BuildAbilityInfo(
+    const std::string& moduleName, const std::string& abilityName) const
+{
+    if (bundleInfo_ == nullptr) {
+        return nullptr;
+    }
+    auto uid = Constants::UNSPECIFIED_USERID;
+    std::optional<AbilityInfo> ablilityInfo = bundleInfo_->FindAbilityInfo(moduleName, abilityName, uid);
+    if (!ablilityInfo) {
+        return nullptr;
+    }
+    return std::make_shared<AbilityInfo>(std::move(*ablilityInfo));
+}
+
+void BundleContainer::InvalidateSnapshots()
+{
+    std::lock_guard<std::mutex> lock(snapshotMutex_);
+    applicationInfoSnapshot_.reset();
+    bundleInfoSnapshot_.reset();
+    bundleInfoV9Snapshots_.clear();
+    hapModuleInfoSnapshots_.clear();
+    abilityInfoSnapshots_.clear();
 }
 
 std::vector<std::shared_ptr<AbilityInfo>> BundleContainer::GetAbilityInfos() const
@@ -161,6 +334,7 @@ void BundleContainer::SetAppCodePath(const std::string& codePath)
         return;
     }
     bundleInfo_->SetAppCodePath(codePath);
+    InvalidateSnapshots();
 }
 
 void BundleContainer::SetBundleName(const std::string& bundleName)
@@ -170,6 +344,7 @@ void BundleContainer::SetBundleName(const std::string& bundleName)
         return;
     }
     bundleInfo_->SetBundleName(bundleName);
+    InvalidateSnapshots();
 }
 
 void BundleContainer::SetPidAndUid(int32_t pid, int32_t uid)
@@ -180,6 +355,7 @@ void BundleContainer::SetPidAndUid(int32_t pid, int32_t uid)
     }
     bundleInfo_->SetPid(pid);
     bundleInfo_->SetUid(uid);
+    InvalidateSnapshots();
 }
 
 std::string BundleContainer::GetBundleName() const
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "hsp_module_json_cache.h"
+
+#include <sys/stat.h>
+
+#include "bundle_parser.h"
+#include "hilog.h"
+
+namespace OHOS {
+namespace AppExecFwk {
+namespace {
+bool GetFileStat(const std::string& path, int64_t& modifyTime, int64_t& fileSize)
+{
+    struct stat fileStat;
+    if (stat(path.c_str(), &fileStat) != 0) {
+        return false;
+    }
+#ifdef IOS_PLATFORM
+    modifyTime = static_cast<int64_t>(fileStat.st_mtimespec.tv_sec) * 1000000000 + fileStat.st_mtimespec.tv_nsec;
+#else
+    modifyTime = static_cast<int64_t>(fileStat.st_mtim.tv_sec) * 1000000000 + fileStat.st_mtim.tv_nsec;
+#endif
+    fileSize = static_cast<int64_t>(fileStat.st_size);
+    return true;
+}
+} // namespace
+
+HspModuleJsonCache& HspModuleJsonCache::GetInstance()
+{
+    static HspModuleJsonCache instance;
+    return instance;
+}
+
+std::shared_ptr<const InnerBundleInfo> HspModuleJsonCache::GetModuleInfo(
+    const std::string& jsonPath, const BufferLoader& loader)
+{
+    int64_t modifyTime = 0;
+    int64_t fileSize = 0;
+    bool hasStat = GetFileStat(jsonPath, modifyTime, fileSize);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(jsonPath);
+    if (it != entries_.end()) {
+        if (hasStat && it->second.modifyTime == modifyTime && it->second.fileSize == fileSize) {
+            return it->second.moduleInfo;
+        }
+        entries_.erase(it);
+    }
+
+    if (!loader) {
+        return nullptr;
+    }
+    auto buffer = loader(jsonPath);
+    if (buffer.empty()) {
+        HILOG_ERROR("HspModuleJsonCache get buffer failed.");
+        return nullptr;
+    }
+    auto moduleInfo = std::make_shared<InnerBundleInfo>();
+    BundleParser parser;
+    if (parser.Parse(buffer, *moduleInfo) != ERR_OK) {
+        HILOG_ERROR("HspModuleJsonCache parse module json failed.");
+        return nullptr;
+    }
+    // Without a stat the freshness of the file is unknown, so the result is not kept.
+    if (hasStat) {
+        entries_[jsonPath] = { modifyTime, fileSize, moduleInfo };
+    }
+    return moduleInfo;
+}
+
+void HspModuleJsonCache::Invalidate(const std::string& jsonPath)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.erase(jsonPath);
+}
+
+void HspModuleJsonCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+}
+} // namespace AppExecFwk
+} // namespace OHOS
@@ -18,6 +18,7 @@
 #include <algorithm>
 #include <deque>
 #include <regex>
+#include <unordered_set>
 
 #include "common_profile.h"
 #include "hilog.h"
@@ -344,6 +345,8 @@ InnerBundleInfo& InnerBundleInfo::operator=(const InnerBundleInfo& info)
     this->onlyCreateBundleUser_ = info.onlyCreateBundleUser_;
     this->innerModuleInfos_ = info.innerModuleInfos_;
     this->baseAbilityInfos_ = info.baseAbilityInfos_;
+    this->moduleNameIndex_ = info.moduleNameIndex_;
+    this->abilityIndex_ = info.abilityIndex_;
     this->skillInfos_ = info.skillInfos_;
     this->innerBundleUserInfos_ = info.innerBundleUserInfos_;
     this->isNewVersion_ = info.isNewVersion_;
@@ -728,6 +731,7 @@ int32_t InnerBundleInfo::FromJson(const nlohmann::json& jsonObject)
         baseAbilityInfos_, JsonType::OBJECT, true, ProfileReader::parseResult, ArrayType::NOT_ARRAY);
     GetValueIfFindKey<std::map<std::string, InnerModuleInfo>>(jsonObject, jsonObjectEnd, INNER_MODULE_INFO,
         innerModuleInfos_, JsonType::OBJECT, true, ProfileReader::parseResult, ArrayType::NOT_ARRAY);
+    RebuildIndexes();
     GetValueIfFindKey<std::map<std::string, std::vector<Skill>>>(jsonObject, jsonObjectEnd, SKILL_INFOS, skillInfos_,
         JsonType::OBJECT, true, ProfileReader::parseResult, ArrayType::NOT_ARRAY);
     GetValueIfFindKey<int>(jsonObject, jsonObjectEnd, USER_ID, userId_, JsonType::NUMBER, true,
@@ -852,6 +856,17 @@ std::optional<HapModuleInfo> InnerBundleInfo::FindHapModuleInfo(const std::strin
 std::optional<AbilityInfo> InnerBundleInfo::FindAbilityInfo(
     const std::string& moduleName, const std::string& abilityName, int32_t userId) const
 {
+    if (!moduleName.empty()) {
+        const AbilityInfo* indexedInfo = FindIndexedAbilityInfo(moduleName, abilityName);
+        if (indexedInfo == nullptr) {
+            return std::nullopt;
+        }
+        AbilityInfo abilityInfo = *indexedInfo;
+        GetApplicationInfo(ApplicationFlag::GET_APPLICATION_INFO_WITH_PERMISSION |
+                               ApplicationFlag::GET_APPLICATION_INFO_WITH_CERTIFICATE_FINGERPRINT,
+            userId, abilityInfo.applicationInfo);
+        return abilityInfo;
+    }
     for (const auto& ability : baseAbilityInfos_) {
         auto abilityInfo = ability.second;
         if ((abilityInfo.name == abilityName) && (moduleName.empty() || (abilityInfo.moduleName == moduleName))) {
@@ -867,6 +882,13 @@ std::optional<AbilityInfo> InnerBundleInfo::FindAbilityInfo(
 std::optional<AbilityInfo> InnerBundleInfo::FindAbilityInfoV9(
     const std::string& moduleName, const std::string& abilityName) const
 {
+    if (!moduleName.empty()) {
+        const AbilityInfo* indexedInfo = FindIndexedAbilityInfo(moduleName, abilityName);
+        if (indexedInfo == nullptr) {
+            return std::nullopt;
+        }
+        return *indexedInfo;
+    }
     for (const auto& ability : baseAbilityInfos_) {
         auto abilityInfo = ability.second;
         if ((abilityInfo.name == abilityName) && (moduleName.empty() || (abilityInfo.moduleName == moduleName))) {
@@ -879,22 +901,15 @@ std::optional<AbilityInfo> InnerBundleInfo::FindAbilityInfoV9(
 ErrCode InnerBundleInfo::FindAbilityInfo(
     const std::string& moduleName, const std::string& abilityName, AbilityInfo& info) const
 {
-    bool isModuleFind = false;
-    for (const auto& ability : baseAbilityInfos_) {
-        auto abilityInfo = ability.second;
-        if ((abilityInfo.moduleName == moduleName)) {
-            isModuleFind = true;
-            if (abilityInfo.name == abilityName) {
-                info = abilityInfo;
-                return ERR_OK;
-            }
-        }
+    if (abilityIndex_.find(moduleName) == abilityIndex_.end()) {
+        return ERR_BUNDLE_MANAGER_MODULE_NOT_EXIST;
     }
-    if (isModuleFind) {
+    const AbilityInfo* indexedInfo = FindIndexedAbilityInfo(moduleName, abilityName);
+    if (indexedInfo == nullptr) {
         return ERR_BUNDLE_MANAGER_ABILITY_NOT_EXIST;
-    } else {
-        return ERR_BUNDLE_MANAGER_MODULE_NOT_EXIST;
     }
+    info = *indexedInfo;
+    return ERR_OK;
 }
 
 std::optional<std::vector<AbilityInfo>> InnerBundleInfo::FindAbilityInfos(int32_t userId) const
@@ -928,6 +943,7 @@ bool InnerBundleInfo::AddModuleInfo(const InnerBundleInfo& newInfo)
         HILOG_ERROR("current package %{public}s is exist", currentPackage_.c_str());
         return false;
     }
+    // Only the module entries are copied, the indexes are updated as each of them is inserted.
     AddInnerModuleInfo(newInfo.innerModuleInfos_);
     AddModuleAbilityInfo(newInfo.baseAbilityInfos_);
     AddModuleSkillInfo(newInfo.skillInfos_);
@@ -935,6 +951,23 @@ bool InnerBundleInfo::AddModuleInfo(const InnerBundleInfo& newInfo)
     return true;
 }
 
+bool InnerBundleInfo::AddModuleInfo(InnerBundleInfo&& newInfo)
+{
+    if (newInfo.currentPackage_.empty()) {
+        HILOG_ERROR("current package is empty");
+        return false;
+    }
+    if (FindModule(newInfo.currentPackage_)) {
+        HILOG_ERROR("current package %{public}s is exist", currentPackage_.c_str());
+        return false;
+    }
+    AddInnerModuleInfo(std::move(newInfo.innerModuleInfos_));
+    AddModuleAbilityInfo(std::move(newInfo.baseAbilityInfos_));
+    AddModuleSkillInfo(std::move(newInfo.skillInfos_));
+    AddModuleExtensionSkillInfos(std::move(newInfo.extensionSkillInfos_));
+    return true;
+}
+
 void InnerBundleInfo::UpdateBaseBundleInfo(const BundleInfo& bundleInfo, bool isEntry)
 {
     baseBundleInfo_->name = bundleInfo.name;
@@ -1021,6 +1054,7 @@ void InnerBundleInfo::UpdateAppDetailAbilityAttrs()
         if (iter->second.name == Constants::APP_DETAIL_ABILITY) {
             if (!baseApplicationInfo_->needAppDetail) {
                 baseAbilityInfos_.erase(iter);
+                RebuildIndexes();
                 return;
             }
             if (isNewVersion_) {
@@ -1078,6 +1112,20 @@ void InnerBundleInfo::UpdateModuleInfo(const InnerBundleInfo& newInfo)
     AddModuleExtensionSkillInfos(newInfo.extensionSkillInfos_);
 }
 
+void InnerBundleInfo::UpdateModuleInfo(InnerBundleInfo&& newInfo)
+{
+    if (newInfo.currentPackage_.empty()) {
+        HILOG_ERROR("no package in new info");
+        return;
+    }
+
+    RemoveModuleInfo(newInfo.currentPackage_);
+    AddInnerModuleInfo(std::move(newInfo.innerModuleInfos_));
+    AddModuleAbilityInfo(std::move(newInfo.baseAbilityInfos_));
+    AddModuleSkillInfo(std::move(newInfo.skillInfos_));
+    AddModuleExtensionSkillInfos(std::move(newInfo.extensionSkillInfos_));
+}
+
 void InnerBundleInfo::RemoveModuleInfo(const std::string& modulePackage)
 {
     auto it = innerModuleInfos_.find(modulePackage);
@@ -1123,6 +1171,60 @@ void InnerBundleInfo::RemoveModuleInfo(const std::string& modulePackage)
 
         extensionSkillInfos_.erase(extensionSkillItem);
     }
+    RebuildIndexes();
+}
+
+void InnerBundleInfo::IndexInnerModuleInfo(const std::string& modulePackage, const InnerModuleInfo& innerModuleInfo)
+{
+    auto result = moduleNameIndex_.try_emplace(innerModuleInfo.moduleName, modulePackage);
+    if (!result.second && modulePackage < result.first->second) {
+        result.first->second = modulePackage;
+    }
+}
+
+void InnerBundleInfo::IndexAbilityInfo(const std::string& key, const AbilityInfo& abilityInfo)
+{
+    auto result = abilityIndex_[abilityInfo.moduleName].try_emplace(abilityInfo.name, key);
+    if (!result.second && key < result.first->second) {
+        result.first->second = key;
+    }
+}
+
+void InnerBundleInfo::RebuildIndexes()
+{
+    moduleNameIndex_.clear();
+    abilityIndex_.clear();
+    for (const auto& info : innerModuleInfos_) {
+        IndexInnerModuleInfo(info.first, info.second);
+    }
+    for (const auto& ability : baseAbilityInfos_) {
+        IndexAbilityInfo(ability.first, ability.second);
+    }
+}
+
+const InnerModuleInfo* InnerBundleInfo::FindInnerModuleInfo(const std::string& moduleName) const
+{
+    auto indexIter = moduleNameIndex_.find(moduleName);
+    if (indexIter == moduleNameIndex_.end()) {
+        return nullptr;
+    }
+    auto infoIter = innerModuleInfos_.find(indexIter->second);
+    return infoIter == innerModuleInfos_.end() ? nullptr : &infoIter->second;
+}
+
+const AbilityInfo* InnerBundleInfo::FindIndexedAbilityInfo(
+    const std::string& moduleName, const std::string& abilityName) const
+{
+    auto moduleIter = abilityIndex_.find(moduleName);
+    if (moduleIter == abilityIndex_.end()) {
+        return nullptr;
+    }
+    auto keyIter = moduleIter->second.find(abilityName);
+    if (keyIter == moduleIter->second.end()) {
+        return nullptr;
+    }
+    auto abilityIter = baseAbilityInfos_.find(keyIter->second);
+    return abilityIter == baseAbilityInfos_.end() ? nullptr : &abilityIter->second;
 }
 
 std::string InnerBundleInfo::ToString() const
@@ -1396,14 +1498,12 @@ bool InnerBundleInfo::CheckSpecialMetaData(const std::string& metaData) const
 
 std::optional<InnerModuleInfo> InnerBundleInfo::GetInnerModuleInfoByModuleName(const std::string& moduleName) const
 {
-    for (const auto& innerModuleInfo : innerModuleInfos_) {
-        HILOG_INFO("info.moduleName = %{public}s, moduleName= %{public}s", innerModuleInfo.second.moduleName.c_str(),
-            moduleName.c_str());
-        if (innerModuleInfo.second.moduleName == moduleName) {
-            return innerModuleInfo.second;
-        }
+    const InnerModuleInfo* innerModuleInfo = FindInnerModuleInfo(moduleName);
+    if (innerModuleInfo == nullptr) {
+        HILOG_INFO("module %{public}s is not found", moduleName.c_str());
+        return std::nullopt;
     }
-    return std::nullopt;
+    return *innerModuleInfo;
 }
 
 void InnerBundleInfo::GetModuleNames(std::vector<std::string>& moduleNames) const
@@ -1882,16 +1982,15 @@ int32_t InnerBundleInfo::GetResponseUserId(int32_t requestUserId) const
 bool InnerBundleInfo::GetDependentModuleNames(
     const std::string& moduleName, std::vector<std::string>& dependentModuleNames) const
 {
-    for (auto iter = innerModuleInfos_.begin(); iter != innerModuleInfos_.end(); ++iter) {
-        if (iter->second.moduleName == moduleName) {
-            for (const auto& dependency : iter->second.dependencies) {
-                dependentModuleNames.push_back(dependency.moduleName);
-            }
-            return true;
-        }
+    const InnerModuleInfo* innerModuleInfo = FindInnerModuleInfo(moduleName);
+    if (innerModuleInfo == nullptr) {
+        HILOG_ERROR("GetDependentModuleNames can not find module %{public}s", moduleName.c_str());
+        return false;
     }
-    HILOG_ERROR("GetDependentModuleNames can not find module %{public}s", moduleName.c_str());
-    return false;
+    for (const auto& dependency : innerModuleInfo->dependencies) {
+        dependentModuleNames.push_back(dependency.moduleName);
+    }
+    return true;
 }
 
 bool InnerBundleInfo::GetAllDependentModuleNames(
@@ -1903,16 +2002,24 @@ bool InnerBundleInfo::GetAllDependentModuleNames(
     std::deque<std::string> moduleDeque;
     std::copy(dependentModuleNames.begin(), dependentModuleNames.end(), std::back_inserter(moduleDeque));
     dependentModuleNames.clear();
+    std::unordered_set<std::string> visitedModuleNames;
     while (!moduleDeque.empty()) {
-        std::string name = moduleDeque.front();
+        std::string name = std::move(moduleDeque.front());
         moduleDeque.pop_front();
-        if (std::find(dependentModuleNames.begin(), dependentModuleNames.end(), name) == dependentModuleNames.end()) {
-            dependentModuleNames.push_back(name);
-            std::vector<std::string> tempModuleNames;
-            if (GetDependentModuleNames(name, tempModuleNames)) {
-                std::copy(tempModuleNames.begin(), tempModuleNames.end(), std::back_inserter(moduleDeque));
+        if (!visitedModuleNames.insert(name).second) {
+            continue;
+        }
+        const InnerModuleInfo* innerModuleInfo = FindInnerModuleInfo(name);
+        if (innerModuleInfo == nullptr) {
+            HILOG_ERROR("GetDependentModuleNames can not find module %{public}s", name.c_str());
+        } else {
+            for (const auto& dependency : innerModuleInfo->dependencies) {
+                if (visitedModuleNames.count(dependency.moduleName) == 0) {
+                    moduleDeque.push_back(dependency.moduleName);
+                }
             }
         }
+        dependentModuleNames.push_back(std::move(name));
     }
     return true;
 }
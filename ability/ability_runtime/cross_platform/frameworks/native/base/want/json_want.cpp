@@ -24,7 +24,6 @@ const std::string JSON_KEY_KEY = "key";
 const std::string JSON_KEY_VALUE = "value";
 const std::string JSON_KEY_TYPE = "type";
 const std::string JSON_KEY_PARAM = "params";
-constexpr uint8_t MAX_JSON_ELEMENT_LENGTH = 255;
 constexpr uint16_t MAX_JSON_ARRAY_LENGTH = 512;
 } // namespace
 
@@ -45,9 +44,8 @@ enum class ArrayType {
 };
 
 template<typename T, typename dataType>
-void CheckArrayType(const nlohmann::json& jsonObject, const std::string& key, dataType& data, ArrayType arrayType)
+void CheckArrayType(const nlohmann::json& arrays, const std::string& key, dataType& data, ArrayType arrayType)
 {
-    auto arrays = jsonObject.at(key);
     if (arrays.empty()) {
         return;
     }
@@ -62,7 +60,7 @@ void CheckArrayType(const nlohmann::json& jsonObject, const std::string& key, da
                     break;
                 }
             }
-            data = jsonObject.at(key).get<T>();
+            data = arrays.get<T>();
             break;
         case ArrayType::NOT_ARRAY:
             HILOG_ERROR("array %{public}s is not string type", key.c_str());
@@ -77,44 +75,44 @@ template<typename T, typename dataType>
 void GetValueIfFindKey(const nlohmann::json& jsonObject, const nlohmann::detail::iter_impl<const nlohmann::json>& end,
     const std::string& key, dataType& data, JsonType jsonType, bool isNecessary, ArrayType arrayType)
 {
-    if (jsonObject.find(key) != end) {
+    auto iter = jsonObject.find(key);
+    if (iter != end) {
+        const nlohmann::json& value = *iter;
         switch (jsonType) {
             case JsonType::BOOLEAN:
-                if (!jsonObject.at(key).is_boolean()) {
+                if (!value.is_boolean()) {
                     HILOG_ERROR("type is error %{public}s is not boolean", key.c_str());
                     break;
                 }
-                data = jsonObject.at(key).get<T>();
+                data = value.get<T>();
                 break;
             case JsonType::NUMBER:
-                if (!jsonObject.at(key).is_number()) {
+                if (!value.is_number()) {
                     HILOG_ERROR("type is error %{public}s is not number", key.c_str());
                     break;
                 }
-                data = jsonObject.at(key).get<T>();
+                data = value.get<T>();
                 break;
             case JsonType::OBJECT:
-                if (!jsonObject.at(key).is_object()) {
+                if (!value.is_object()) {
                     HILOG_ERROR("type is error %{public}s is not object", key.c_str());
                     break;
                 }
-                data = jsonObject.at(key).get<T>();
+                data = value.get<T>();
                 break;
             case JsonType::ARRAY:
-                if (!jsonObject.at(key).is_array()) {
+                if (!value.is_array()) {
                     HILOG_ERROR("type is error %{public}s is not array", key.c_str());
                     break;
                 }
-                CheckArrayType<T>(jsonObject, key, data, arrayType);
+                CheckArrayType<T>(value, key, data, arrayType);
                 break;
             case JsonType::STRING:
-                if (!jsonObject.at(key).is_string()) {
+                if (!value.is_string()) {
                     HILOG_ERROR("type is error %{public}s is not string", key.c_str());
                     break;
                 }
-                data = jsonObject.at(key).get<T>();
-                if (jsonObject.at(key).get<std::string>().length() > MAX_JSON_ELEMENT_LENGTH) {
-                }
+                data = value.get<T>();
                 break;
             case JsonType::NULLABLE:
                 HILOG_ERROR("type is error %{public}s is nullable", key.c_str());
@@ -16,7 +16,6 @@
 #include "want.h"
 
 #include <memory>
-#include <regex>
 
 #include "array_wrapper.h"
 #include "base_interfaces.h"
@@ -30,6 +29,7 @@
 #include "securec.h"
 #include "short_wrapper.h"
 #include "string_wrapper.h"
+#include "want_binary_codec.h"
 #include "want_params.h"
 #include "want_params_wrapper.h"
 
@@ -42,32 +42,86 @@ const std::string Want::ACTION_VIEWDATA("ohos.want.action.viewData");
 const std::string Want::ENTITY_BROWSER("entity.system.browsable");
 namespace {
 using Json = nlohmann::json;
-const std::regex NUMBER_REGEX("^[-+]?([0-9]+)([.]([0-9]+))?$");
-const std::regex BOOL_REGEX("^(true|false)$");
-const std::regex INT_REGEX("^[-+]?([0-9]+)$");
+constexpr char BOOL_TRUE[] = "true";
+constexpr char BOOL_FALSE[] = "false";
+
+bool IsSpaceChar(char ch)
+{
+    return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\v' || ch == '\f' || ch == '\r';
+}
+
+std::string TrimSpace(const std::string& value)
+{
+    size_t begin = 0;
+    size_t end = value.size();
+    while (begin < end && IsSpaceChar(value[begin])) {
+        begin++;
+    }
+    while (end > begin && IsSpaceChar(value[end - 1])) {
+        end--;
+    }
+    return value.substr(begin, end - begin);
+}
+
+// Skips a run of decimal digits starting at pos, returns false when there is none.
+bool SkipDigits(const std::string& value, size_t& pos)
+{
+    size_t begin = pos;
+    while (pos < value.size() && value[pos] >= '0' && value[pos] <= '9') {
+        pos++;
+    }
+    return pos > begin;
+}
+
+// Matches ^[-+]?[0-9]+$
+bool IsIntText(const std::string& value)
+{
+    size_t pos = (!value.empty() && (value[0] == '-' || value[0] == '+')) ? 1 : 0;
+    return SkipDigits(value, pos) && pos == value.size();
+}
+
+// Matches ^[-+]?[0-9]+([.][0-9]+)?$
+bool IsNumberText(const std::string& value)
+{
+    size_t pos = (!value.empty() && (value[0] == '-' || value[0] == '+')) ? 1 : 0;
+    if (!SkipDigits(value, pos)) {
+        return false;
+    }
+    if (pos < value.size() && value[pos] == '.') {
+        pos++;
+        if (!SkipDigits(value, pos)) {
+            return false;
+        }
+    }
+    return pos == value.size();
+}
+
+bool IsBoolText(const std::string& value)
+{
+    return value == BOOL_TRUE || value == BOOL_FALSE;
+}
 
 void SetBoolIntDouble(AAFwk::WantParams& wantParams, const std::string& key, const std::string& value,
     const OHOS::AAFwk::WantValueType type)
 {
-    std::regex pattern(R"(^\s+|\s+$)");
-    std::string valueStr = std::regex_replace(value, pattern, "");
+    std::string valueStr = TrimSpace(value);
     switch (type) {
         case OHOS::AAFwk::WantValueType::VALUE_TYPE_INT:
-            if (std::regex_match(valueStr, INT_REGEX)) {
+            if (IsIntText(valueStr)) {
                 wantParams.SetParam(key, WantParams::GetInterfaceByType(static_cast<int>(type), valueStr));
             } else {
                 HILOG_ERROR("Want parse failed. int value is incorrect. value = %{public}s", valueStr.c_str());
             }
             break;
         case OHOS::AAFwk::WantValueType::VALUE_TYPE_BOOLEAN:
-            if (std::regex_match(valueStr, BOOL_REGEX)) {
+            if (IsBoolText(valueStr)) {
                 wantParams.SetParam(key, WantParams::GetInterfaceByType(static_cast<int>(type), valueStr));
             } else {
                 HILOG_ERROR("Want parse failed. bool value is incorrect. value = %{public}s", valueStr.c_str());
             }
             break;
         case OHOS::AAFwk::WantValueType::VALUE_TYPE_DOUBLE:
-            if (std::regex_match(valueStr, NUMBER_REGEX)) {
+            if (IsNumberText(valueStr)) {
                 wantParams.SetParam(key, WantParams::GetInterfaceByType(static_cast<int>(type) - 1, valueStr));
             } else {
                 HILOG_ERROR("Want parse failed. double value is incorrect. value = %{public}s", valueStr.c_str());
@@ -121,20 +175,6 @@ bool CheckParamsIsVaild(const std::string& params, Json& jsonObject)
     }
     return true;
 }
-
-template<typename T1, typename T2, typename T3>
-void GetArrayParams(IArray* ao, std::vector<T3>& array)
-{
-    auto func = [&](IInterface* object) {
-        if (object != nullptr) {
-            T1* value = T1::Query(object);
-            if (value != nullptr) {
-                array.push_back(T2::Unbox(value));
-            }
-        }
-    };
-    Array::ForEach(ao, func);
-}
 }; // namespace
 
 /**
@@ -170,6 +210,24 @@ Want& Want::operator=(const Want& want)
     return *this;
 }
 
+/**
+ * @description: Move constructor of Want class, which takes over the strings and entities of the source.
+ * @param want the source instance of Want.
+ * @return None
+ */
+Want::Want(Want&& want) noexcept
+{
+    InnerMoveWant(want);
+}
+
+Want& Want::operator=(Want&& want) noexcept
+{
+    if (this != &want) {
+        InnerMoveWant(want);
+    }
+    return *this;
+}
+
 /**
  * @description: clear the specific want object.
  * @param want Indicates the want to clear
@@ -215,11 +273,7 @@ bool Want::GetBoolParam(const std::string& key, bool defaultValue) const
 std::vector<bool> Want::GetBoolArrayParam(const std::string& key) const
 {
     std::vector<bool> array;
-    auto value = std::static_pointer_cast<WantParams>(wantParams_)->GetParam(key);
-    IArray* ao = IArray::Query(value);
-    if (ao != nullptr && Array::IsBooleanArray(ao)) {
-        GetArrayParams<IBoolean, Boolean, bool>(ao, array);
-    }
+    std::static_pointer_cast<WantParams>(wantParams_)->GetArrayParam(key, array);
     return array;
 }
 
@@ -243,14 +297,7 @@ Want& Want::SetParam(const std::string& key, bool value)
  */
 Want& Want::SetParam(const std::string& key, const std::vector<bool>& value)
 {
-    std::size_t size = value.size();
-    sptr<IArray> ao = new (std::nothrow) Array(size, g_IID_IBoolean);
-    if (ao != nullptr) {
-        for (std::size_t i = 0; i < size; i++) {
-            ao->Set(i, Boolean::Box(value[i]));
-        }
-        std::static_pointer_cast<WantParams>(wantParams_)->SetParam(key, ao);
-    }
+    std::static_pointer_cast<WantParams>(wantParams_)->SetArrayParam(key, value);
     return *this;
 }
 
@@ -280,11 +327,7 @@ int Want::GetIntParam(const std::string& key, const int defaultValue) const
 std::vector<int> Want::GetIntArrayParam(const std::string& key) const
 {
     std::vector<int> array;
-    auto value = std::static_pointer_cast<WantParams>(wantParams_)->GetParam(key);
-    IArray* ao = IArray::Query(value);
-    if (ao != nullptr && Array::IsIntegerArray(ao)) {
-        GetArrayParams<IInteger, Integer, int>(ao, array);
-    }
+    std::static_pointer_cast<WantParams>(wantParams_)->GetArrayParam(key, array);
     return array;
 }
 
@@ -308,15 +351,7 @@ Want& Want::SetParam(const std::string& key, int value)
  */
 Want& Want::SetParam(const std::string& key, const std::vector<int>& value)
 {
-    std::size_t size = value.size();
-    sptr<IArray> ao = new (std::nothrow) Array(size, g_IID_IInteger);
-    if (ao == nullptr) {
-        return *this;
-    }
-    for (std::size_t i = 0; i < size; i++) {
-        ao->Set(i, Integer::Box(value[i]));
-    }
-    std::static_pointer_cast<WantParams>(wantParams_)->SetParam(key, ao);
+    std::static_pointer_cast<WantParams>(wantParams_)->SetArrayParam(key, value);
     return *this;
 }
 
@@ -346,11 +381,7 @@ double Want::GetDoubleParam(const std::string& key, double defaultValue) const
 std::vector<double> Want::GetDoubleArrayParam(const std::string& key) const
 {
     std::vector<double> array;
-    auto value = std::static_pointer_cast<WantParams>(wantParams_)->GetParam(key);
-    IArray* ao = IArray::Query(value);
-    if (ao != nullptr && Array::IsDoubleArray(ao)) {
-        GetArrayParams<IDouble, Double, double>(ao, array);
-    }
+    std::static_pointer_cast<WantParams>(wantParams_)->GetArrayParam(key, array);
     return array;
 }
 
@@ -374,15 +405,7 @@ Want& Want::SetParam(const std::string& key, double value)
  */
 Want& Want::SetParam(const std::string& key, const std::vector<double>& value)
 {
-    std::size_t size = value.size();
-    sptr<IArray> ao = new (std::nothrow) Array(size, g_IID_IDouble);
-    if (ao == nullptr) {
-        return *this;
-    }
-    for (std::size_t i = 0; i < size; i++) {
-        ao->Set(i, Double::Box(value[i]));
-    }
-    std::static_pointer_cast<WantParams>(wantParams_)->SetParam(key, ao);
+    std::static_pointer_cast<WantParams>(wantParams_)->SetArrayParam(key, value);
     return *this;
 }
 
@@ -411,11 +434,7 @@ float Want::GetFloatParam(const std::string& key, float defaultValue) const
 std::vector<float> Want::GetFloatArrayParam(const std::string& key) const
 {
     std::vector<float> array;
-    auto value = std::static_pointer_cast<WantParams>(wantParams_)->GetParam(key);
-    IArray* ao = IArray::Query(value);
-    if (ao != nullptr && Array::IsFloatArray(ao)) {
-        GetArrayParams<IFloat, Float, float>(ao, array);
-    }
+    std::static_pointer_cast<WantParams>(wantParams_)->GetArrayParam(key, array);
     return array;
 }
 
@@ -439,16 +458,7 @@ Want& Want::SetParam(const std::string& key, float value)
  */
 Want& Want::SetParam(const std::string& key, const std::vector<float>& value)
 {
-    std::size_t size = value.size();
-    sptr<IArray> ao = new (std::nothrow) Array(size, g_IID_IFloat);
-    if (ao == nullptr) {
-        return *this;
-    }
-
-    for (std::size_t i = 0; i < size; i++) {
-        ao->Set(i, Float::Box(value[i]));
-    }
-    std::static_pointer_cast<WantParams>(wantParams_)->SetParam(key, ao);
+    std::static_pointer_cast<WantParams>(wantParams_)->SetArrayParam(key, value);
     return *this;
 }
 
@@ -466,7 +476,7 @@ long Want::GetLongParam(const std::string& key, long defaultValue) const
         return Long::Unbox(ILong::Query(value));
     } else if (IString::Query(value) != nullptr) {
         std::string str = String::Unbox(IString::Query(value));
-        if (std::regex_match(str, NUMBER_REGEX)) {
+        if (IsNumberText(str)) {
             return std::atoll(str.c_str());
         }
     }
@@ -482,21 +492,17 @@ long Want::GetLongParam(const std::string& key, long defaultValue) const
 std::vector<long> Want::GetLongArrayParam(const std::string& key) const
 {
     std::vector<long> array;
-    auto value = std::static_pointer_cast<WantParams>(wantParams_)->GetParam(key);
-    IArray* ao = IArray::Query(value);
-    if (ao != nullptr && Array::IsLongArray(ao)) {
-        GetArrayParams<ILong, Long, long>(ao, array);
-    } else if (ao != nullptr && Array::IsStringArray(ao)) {
-        auto func = [&](IInterface* object) {
-            IString* o = IString::Query(object);
-            if (o != nullptr) {
-                std::string str = String::Unbox(o);
-                if (std::regex_match(str, NUMBER_REGEX)) {
-                    array.push_back(std::atoll(str.c_str()));
-                }
+    auto wantParams = std::static_pointer_cast<WantParams>(wantParams_);
+    if (wantParams->GetArrayParam(key, array)) {
+        return array;
+    }
+    std::vector<std::string> strArray;
+    if (wantParams->GetArrayParam(key, strArray)) {
+        for (const auto& str : strArray) {
+            if (IsNumberText(str)) {
+                array.push_back(std::atoll(str.c_str()));
             }
-        };
-        Array::ForEach(ao, func);
+        }
     }
     return array;
 }
@@ -521,15 +527,7 @@ Want& Want::SetParam(const std::string& key, long value)
  */
 Want& Want::SetParam(const std::string& key, const std::vector<long>& value)
 {
-    std::size_t size = value.size();
-    sptr<IArray> ao = new (std::nothrow) Array(size, g_IID_ILong);
-    if (ao == nullptr) {
-        return *this;
-    }
-    for (std::size_t i = 0; i < size; i++) {
-        ao->Set(i, Long::Box(value[i]));
-    }
-    std::static_pointer_cast<WantParams>(wantParams_)->SetParam(key, ao);
+    std::static_pointer_cast<WantParams>(wantParams_)->SetArrayParam(key, value);
     return *this;
 }
 
@@ -565,11 +563,7 @@ short Want::GetShortParam(const std::string& key, short defaultValue) const
 std::vector<short> Want::GetShortArrayParam(const std::string& key) const
 {
     std::vector<short> array;
-    auto value = std::static_pointer_cast<WantParams>(wantParams_)->GetParam(key);
-    IArray* ao = IArray::Query(value);
-    if (ao != nullptr && Array::IsShortArray(ao)) {
-        GetArrayParams<IShort, Short, short>(ao, array);
-    }
+    std::static_pointer_cast<WantParams>(wantParams_)->GetArrayParam(key, array);
     return array;
 }
 
@@ -593,15 +587,7 @@ Want& Want::SetParam(const std::string& key, short value)
  */
 Want& Want::SetParam(const std::string& key, const std::vector<short>& value)
 {
-    std::size_t size = value.size();
-    sptr<IArray> ao = new (std::nothrow) Array(size, g_IID_IShort);
-    if (ao == nullptr) {
-        return *this;
-    }
-    for (std::size_t i = 0; i < size; i++) {
-        ao->Set(i, Short::Box(value[i]));
-    }
-    std::static_pointer_cast<WantParams>(wantParams_)->SetParam(key, ao);
+    std::static_pointer_cast<WantParams>(wantParams_)->SetArrayParam(key, value);
     return *this;
 }
 
@@ -630,11 +616,7 @@ std::string Want::GetStringParam(const std::string& key) const
 std::vector<std::string> Want::GetStringArrayParam(const std::string& key) const
 {
     std::vector<std::string> array;
-    auto value = std::static_pointer_cast<WantParams>(wantParams_)->GetParam(key);
-    IArray* ao = IArray::Query(value);
-    if (ao != nullptr && Array::IsStringArray(ao)) {
-        GetArrayParams<IString, String, std::string>(ao, array);
-    }
+    std::static_pointer_cast<WantParams>(wantParams_)->GetArrayParam(key, array);
     return array;
 }
 
@@ -735,15 +717,7 @@ Want& Want::SetParam(const std::string& key, const std::string& value)
  */
 Want& Want::SetParam(const std::string& key, const std::vector<std::string>& value)
 {
-    std::size_t size = value.size();
-    sptr<IArray> ao = new (std::nothrow) Array(size, g_IID_IString);
-    if (ao == nullptr) {
-        return *this;
-    }
-    for (std::size_t i = 0; i < size; i++) {
-        ao->Set(i, String::Box(value[i]));
-    }
-    std::static_pointer_cast<WantParams>(wantParams_)->SetParam(key, ao);
+    std::static_pointer_cast<WantParams>(wantParams_)->SetArrayParam(key, value);
     return *this;
 }
 
@@ -831,6 +805,18 @@ void Want::ParseJson(const std::string& jsonParams)
     }
 }
 
+std::string Want::ToBinary() const
+{
+    std::string buffer;
+    WantBinaryCodec::Encode(*this, buffer);
+    return buffer;
+}
+
+bool Want::ParseBinary(const uint8_t* data, size_t size)
+{
+    return WantBinaryCodec::Decode(data, size, *this);
+}
+
 bool Want::IsEmpty() const
 {
     if (!bundleName_.empty() || !abilityName_.empty() || !moduleName_.empty() || !type_.empty()) {
@@ -854,5 +840,19 @@ void Want::InnerCopyWant(const Want& want)
     uri_ = want.uri_;
     entities_ = want.entities_;
 }
+
+void Want::InnerMoveWant(Want& want) noexcept
+{
+    bundleName_ = std::move(want.bundleName_);
+    moduleName_ = std::move(want.moduleName_);
+    abilityName_ = std::move(want.abilityName_);
+    // The source keeps a WantParams of its own, so a later SetParam on it can not reach this Want.
+    wantParams_ = std::move(want.wantParams_);
+    want.wantParams_ = std::make_shared<WantParams>();
+    type_ = std::move(want.type_);
+    action_ = std::move(want.action_);
+    uri_ = std::move(want.uri_);
+    entities_ = std::move(want.entities_);
+}
 } // namespace AAFwk
 } // namespace OHOS
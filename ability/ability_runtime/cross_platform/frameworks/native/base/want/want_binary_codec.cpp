@@ -0,0 +1,683 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "want_binary_codec.h"
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "array_wrapper.h"
+#include "bool_wrapper.h"
+#include "byte_wrapper.h"
+#include "double_wrapper.h"
+#include "float_wrapper.h"
+#include "hilog.h"
+#include "int_wrapper.h"
+#include "long_wrapper.h"
+#include "short_wrapper.h"
+#include "string_wrapper.h"
+#include "want.h"
+#include "want_params.h"
+#include "want_params_wrapper.h"
+#include "zchar_wrapper.h"
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "WantBinaryCodec copies values in native byte order and expects a little endian target"
+#endif
+
+namespace OHOS {
+namespace AAFwk {
+namespace {
+constexpr uint8_t MAGIC[] = { '\0', 'W', 'N', 'B' };
+constexpr size_t HEADER_SIZE = sizeof(MAGIC) + sizeof(uint8_t);
+constexpr int MAX_DEPTH = 100;
+
+enum ValueTag : uint8_t {
+    TAG_NULL = 0,
+    TAG_BOOLEAN = 1,
+    TAG_BYTE = 2,
+    TAG_CHAR = 3,
+    TAG_SHORT = 4,
+    TAG_INT = 5,
+    TAG_LONG = 6,
+    TAG_FLOAT = 7,
+    TAG_DOUBLE = 8,
+    TAG_STRING = 9,
+    TAG_WANTPARAMS = 10,
+    TAG_ARRAY = 11,
+};
+
+// Set on the element tag of an array that is written element by element instead of as one block.
+constexpr uint8_t BOXED_ELEMENTS = 0x80;
+
+ValueTag GetElementTag(IArray* array)
+{
+    InterfaceID typeId;
+    array->GetType(typeId);
+    if (typeId == g_IID_IBoolean) {
+        return TAG_BOOLEAN;
+    } else if (typeId == g_IID_IByte) {
+        return TAG_BYTE;
+    } else if (typeId == g_IID_IChar) {
+        return TAG_CHAR;
+    } else if (typeId == g_IID_IShort) {
+        return TAG_SHORT;
+    } else if (typeId == g_IID_IInteger) {
+        return TAG_INT;
+    } else if (typeId == g_IID_ILong) {
+        return TAG_LONG;
+    } else if (typeId == g_IID_IFloat) {
+        return TAG_FLOAT;
+    } else if (typeId == g_IID_IDouble) {
+        return TAG_DOUBLE;
+    } else if (typeId == g_IID_IString) {
+        return TAG_STRING;
+    } else if (typeId == g_IID_IWantParams) {
+        return TAG_WANTPARAMS;
+    } else if (typeId == g_IID_IArray) {
+        return TAG_ARRAY;
+    }
+    return TAG_NULL;
+}
+
+const InterfaceID* GetElementId(uint8_t tag)
+{
+    switch (tag) {
+        case TAG_BOOLEAN:
+            return &g_IID_IBoolean;
+        case TAG_BYTE:
+            return &g_IID_IByte;
+        case TAG_SHORT:
+            return &g_IID_IShort;
+        case TAG_INT:
+            return &g_IID_IInteger;
+        case TAG_LONG:
+            return &g_IID_ILong;
+        case TAG_FLOAT:
+            return &g_IID_IFloat;
+        case TAG_DOUBLE:
+            return &g_IID_IDouble;
+        case TAG_STRING:
+            return &g_IID_IString;
+        case TAG_CHAR:
+            return &g_IID_IChar;
+        case TAG_WANTPARAMS:
+            return &g_IID_IWantParams;
+        case TAG_ARRAY:
+            return &g_IID_IArray;
+        default:
+            return nullptr;
+    }
+}
+
+// Unpack skips null and mismatched elements, such an array can only be written element by element.
+template<typename T>
+bool UnpackAll(IArray* array, long size, std::vector<T>& values)
+{
+    return Array::Unpack(array, values) && values.size() == static_cast<size_t>(size);
+}
+} // namespace
+
+class WantBinaryCodec::Writer final {
+public:
+    explicit Writer(std::string& buffer) : buffer_(buffer) {}
+
+    template<typename T>
+    void Write(T value)
+    {
+        buffer_.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    void WriteBytes(const void* data, size_t size)
+    {
+        buffer_.append(static_cast<const char*>(data), size);
+    }
+
+    void WriteString(const std::string& value)
+    {
+        Write(static_cast<uint32_t>(value.size()));
+        buffer_.append(value);
+    }
+
+    template<typename T>
+    void WriteBlock(const std::vector<T>& values)
+    {
+        Write(static_cast<uint32_t>(values.size()));
+        WriteBytes(values.data(), values.size() * sizeof(T));
+    }
+
+private:
+    std::string& buffer_;
+};
+
+class WantBinaryCodec::Reader final {
+public:
+    Reader(const uint8_t* data, size_t size) : cursor_(data), end_(data + size) {}
+
+    size_t Remaining() const
+    {
+        return static_cast<size_t>(end_ - cursor_);
+    }
+
+    template<typename T>
+    bool Read(T& value)
+    {
+        if (Remaining() < sizeof(T)) {
+            return false;
+        }
+        memcpy(&value, cursor_, sizeof(T));
+        cursor_ += sizeof(T);
+        return true;
+    }
+
+    bool ReadString(std::string& value)
+    {
+        uint32_t size = 0;
+        if (!Read(size) || Remaining() < size) {
+            return false;
+        }
+        value.assign(reinterpret_cast<const char*>(cursor_), size);
+        cursor_ += size;
+        return true;
+    }
+
+    bool ReadHeader()
+    {
+        uint8_t version = 0;
+        if (Remaining() < sizeof(MAGIC) || memcmp(cursor_, MAGIC, sizeof(MAGIC)) != 0) {
+            return false;
+        }
+        cursor_ += sizeof(MAGIC);
+        return Read(version) && version == VERSION;
+    }
+
+    template<typename T>
+    bool ReadBlock(std::vector<T>& values)
+    {
+        uint32_t count = 0;
+        if (!Read(count) || Remaining() / sizeof(T) < count) {
+            return false;
+        }
+        values.resize(count);
+        if (count > 0) {
+            memcpy(values.data(), cursor_, count * sizeof(T));
+            cursor_ += count * sizeof(T);
+        }
+        return true;
+    }
+
+    template<typename Boxed, typename T>
+    bool ReadBoxed(sptr<IInterface>& value)
+    {
+        T scalar {};
+        if (!Read(scalar)) {
+            return false;
+        }
+        value = Boxed::Box(scalar);
+        return true;
+    }
+
+    template<typename T>
+    bool ReadPacked(sptr<IInterface>& value)
+    {
+        std::vector<T> values;
+        if (!ReadBlock(values)) {
+            return false;
+        }
+        value = Array::Pack(std::move(values));
+        return true;
+    }
+
+private:
+    const uint8_t* cursor_;
+    const uint8_t* end_;
+};
+
+bool WantBinaryCodec::IsBinary(const uint8_t* data, size_t size)
+{
+    return data != nullptr && size >= HEADER_SIZE && memcmp(data, MAGIC, sizeof(MAGIC)) == 0;
+}
+
+bool WantBinaryCodec::IsBinary(const std::string& data)
+{
+    return IsBinary(reinterpret_cast<const uint8_t*>(data.data()), data.size());
+}
+
+void WantBinaryCodec::Encode(const Want& want, std::string& buffer)
+{
+    buffer.clear();
+    Writer writer(buffer);
+    writer.WriteBytes(MAGIC, sizeof(MAGIC));
+    writer.Write(VERSION);
+    writer.WriteString(want.GetType());
+    writer.WriteString(want.GetBundleName());
+    writer.WriteString(want.GetModuleName());
+    writer.WriteString(want.GetAbilityName());
+    writer.WriteString(want.GetAction());
+    writer.WriteString(want.GetUri());
+    const auto& entities = want.GetEntities();
+    writer.Write(static_cast<uint32_t>(entities.size()));
+    for (const auto& entity : entities) {
+        writer.WriteString(entity);
+    }
+    auto wantParams = std::static_pointer_cast<WantParams>(want.GetParams());
+    if (wantParams == nullptr) {
+        WriteParams(writer, WantParams());
+        return;
+    }
+    WriteParams(writer, *wantParams);
+}
+
+void WantBinaryCodec::EncodeParams(const WantParams& wantParams, std::string& buffer)
+{
+    buffer.clear();
+    Writer writer(buffer);
+    writer.WriteBytes(MAGIC, sizeof(MAGIC));
+    writer.Write(VERSION);
+    WriteParams(writer, wantParams);
+}
+
+void WantBinaryCodec::WriteParams(Writer& writer, const WantParams& wantParams)
+{
+    const auto& params = wantParams.GetSortedParams();
+    writer.Write(static_cast<uint32_t>(params.size()));
+    for (const auto& param : params) {
+        writer.WriteString(param.key);
+        WriteValue(writer, param.value.GetRefPtr());
+    }
+    const auto& fds = wantParams.GetFds();
+    writer.Write(static_cast<uint32_t>(fds.size()));
+    for (const auto& fd : fds) {
+        writer.WriteString(fd.first);
+        writer.Write(static_cast<int32_t>(fd.second));
+    }
+}
+
+void WantBinaryCodec::WriteValue(Writer& writer, IInterface* value)
+{
+    if (value == nullptr) {
+        writer.Write(TAG_NULL);
+    } else if (IBoolean::Query(value) != nullptr) {
+        writer.Write(TAG_BOOLEAN);
+        writer.Write(static_cast<uint8_t>(Boolean::Unbox(IBoolean::Query(value))));
+    } else if (IByte::Query(value) != nullptr) {
+        writer.Write(TAG_BYTE);
+        writer.Write(Byte::Unbox(IByte::Query(value)));
+    } else if (IChar::Query(value) != nullptr) {
+        writer.Write(TAG_CHAR);
+        writer.Write(Char::Unbox(IChar::Query(value)));
+    } else if (IShort::Query(value) != nullptr) {
+        writer.Write(TAG_SHORT);
+        writer.Write(Short::Unbox(IShort::Query(value)));
+    } else if (IInteger::Query(value) != nullptr) {
+        writer.Write(TAG_INT);
+        writer.Write(static_cast<int32_t>(Integer::Unbox(IInteger::Query(value))));
+    } else if (ILong::Query(value) != nullptr) {
+        writer.Write(TAG_LONG);
+        writer.Write(static_cast<int64_t>(Long::Unbox(ILong::Query(value))));
+    } else if (IFloat::Query(value) != nullptr) {
+        writer.Write(TAG_FLOAT);
+        writer.Write(Float::Unbox(IFloat::Query(value)));
+    } else if (IDouble::Query(value) != nullptr) {
+        writer.Write(TAG_DOUBLE);
+        writer.Write(Double::Unbox(IDouble::Query(value)));
+    } else if (IString::Query(value) != nullptr) {
+        writer.Write(TAG_STRING);
+        writer.WriteString(String::Unbox(IString::Query(value)));
+    } else if (IArray::Query(value) != nullptr) {
+        WriteArray(writer, IArray::Query(value));
+    } else if (IWantParams::Query(value) != nullptr) {
+        writer.Write(TAG_WANTPARAMS);
+        WriteParams(writer, static_cast<WantParamWrapper*>(IWantParams::Query(value))->wantParams_);
+    } else {
+        writer.Write(TAG_NULL);
+    }
+}
+
+void WantBinaryCodec::WriteArray(Writer& writer, IArray* array)
+{
+    ValueTag elementTag = GetElementTag(array);
+    if (elementTag == TAG_NULL) {
+        writer.Write(TAG_NULL);
+        return;
+    }
+    long size = 0;
+    array->GetLength(size);
+    writer.Write(TAG_ARRAY);
+    switch (elementTag) {
+        case TAG_BOOLEAN: {
+            std::vector<bool> values;
+            if (!UnpackAll(array, size, values)) {
+                break;
+            }
+            std::vector<uint8_t> bytes(values.begin(), values.end());
+            writer.Write(elementTag);
+            writer.WriteBlock(bytes);
+            return;
+        }
+        case TAG_BYTE: {
+            std::vector<byte> values;
+            if (!UnpackAll(array, size, values)) {
+                break;
+            }
+            writer.Write(elementTag);
+            writer.WriteBlock(values);
+            return;
+        }
+        case TAG_SHORT: {
+            std::vector<short> values;
+            if (!UnpackAll(array, size, values)) {
+                break;
+            }
+            writer.Write(elementTag);
+            writer.WriteBlock(values);
+            return;
+        }
+        case TAG_INT: {
+            std::vector<int> values;
+            if (!UnpackAll(array, size, values)) {
+                break;
+            }
+            writer.Write(elementTag);
+            writer.WriteBlock(values);
+            return;
+        }
+        case TAG_LONG: {
+            std::vector<long> values;
+            if (!UnpackAll(array, size, values)) {
+                break;
+            }
+            writer.Write(elementTag);
+            writer.WriteBlock(std::vector<int64_t>(values.begin(), values.end()));
+            return;
+        }
+        case TAG_FLOAT: {
+            std::vector<float> values;
+            if (!UnpackAll(array, size, values)) {
+                break;
+            }
+            writer.Write(elementTag);
+            writer.WriteBlock(values);
+            return;
+        }
+        case TAG_DOUBLE: {
+            std::vector<double> values;
+            if (!UnpackAll(array, size, values)) {
+                break;
+            }
+            writer.Write(elementTag);
+            writer.WriteBlock(values);
+            return;
+        }
+        case TAG_STRING: {
+            std::vector<std::string> values;
+            if (!UnpackAll(array, size, values)) {
+                break;
+            }
+            writer.Write(elementTag);
+            writer.Write(static_cast<uint32_t>(values.size()));
+            for (const auto& value : values) {
+                writer.WriteString(value);
+            }
+            return;
+        }
+        default:
+            break;
+    }
+
+    // Chars, nested arrays, WantParams and typed arrays holding null or mismatched elements are written
+    // element by element, each with its own tag, so the length and indices survive the round trip.
+    writer.Write(static_cast<uint8_t>(elementTag | BOXED_ELEMENTS));
+    writer.Write(static_cast<uint32_t>(size));
+    for (long i = 0; i < size; i++) {
+        sptr<IInterface> element;
+        array->Get(i, element);
+        WriteValue(writer, element.GetRefPtr());
+    }
+}
+
+bool WantBinaryCodec::Decode(const uint8_t* data, size_t size, Want& want)
+{
+    Reader reader(data, size);
+    if (!reader.ReadHeader()) {
+        HILOG_ERROR("Want binary header is invalid.");
+        return false;
+    }
+    std::string type;
+    std::string bundleName;
+    std::string moduleName;
+    std::string abilityName;
+    std::string action;
+    std::string uri;
+    uint32_t entityCount = 0;
+    if (!reader.ReadString(type) || !reader.ReadString(bundleName) || !reader.ReadString(moduleName) ||
+        !reader.ReadString(abilityName) || !reader.ReadString(action) || !reader.ReadString(uri) ||
+        !reader.Read(entityCount) || entityCount > reader.Remaining()) {
+        HILOG_ERROR("Want binary is truncated.");
+        return false;
+    }
+    std::vector<std::string> entities(entityCount);
+    for (auto& entity : entities) {
+        if (!reader.ReadString(entity)) {
+            HILOG_ERROR("Want binary entities are truncated.");
+            return false;
+        }
+    }
+    auto wantParams = std::make_shared<WantParams>();
+    if (!ReadParams(reader, *wantParams, 0) || reader.Remaining() != 0) {
+        HILOG_ERROR("Want binary params are invalid.");
+        return false;
+    }
+
+    want.SetType(type);
+    want.SetBundleName(bundleName);
+    want.SetModuleName(moduleName);
+    want.SetAbilityName(abilityName);
+    want.SetAction(action);
+    want.SetUri(uri);
+    want.SetEntities(entities);
+    want.SetParams(wantParams);
+    return true;
+}
+
+bool WantBinaryCodec::DecodeParams(const uint8_t* data, size_t size, WantParams& wantParams)
+{
+    Reader reader(data, size);
+    WantParams decoded;
+    if (!reader.ReadHeader() || !ReadParams(reader, decoded, 0) || reader.Remaining() != 0) {
+        HILOG_ERROR("WantParams binary is invalid.");
+        return false;
+    }
+    wantParams = std::move(decoded);
+    return true;
+}
+
+bool WantBinaryCodec::ReadParams(Reader& reader, WantParams& wantParams, int depth)
+{
+    if (depth >= MAX_DEPTH) {
+        HILOG_ERROR("Want binary is nested too deep.");
+        return false;
+    }
+    uint32_t count = 0;
+    if (!reader.Read(count) || count > reader.Remaining()) {
+        return false;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        std::string key;
+        sptr<IInterface> value;
+        if (!reader.ReadString(key) || !ReadValue(reader, value, depth)) {
+            return false;
+        }
+        if (value != nullptr) {
+            wantParams.SetParam(key, value);
+        }
+    }
+    uint32_t fdCount = 0;
+    if (!reader.Read(fdCount) || fdCount > reader.Remaining()) {
+        return false;
+    }
+    for (uint32_t i = 0; i < fdCount; i++) {
+        std::string key;
+        int32_t fd = -1;
+        if (!reader.ReadString(key) || !reader.Read(fd)) {
+            return false;
+        }
+        wantParams.MutableNode().fds[key] = fd;
+    }
+    return true;
+}
+
+bool WantBinaryCodec::ReadValue(Reader& reader, sptr<IInterface>& value, int depth)
+{
+    uint8_t tag = TAG_NULL;
+    if (!reader.Read(tag)) {
+        return false;
+    }
+    switch (tag) {
+        case TAG_NULL:
+            value = nullptr;
+            return true;
+        case TAG_BOOLEAN: {
+            uint8_t scalar = 0;
+            if (!reader.Read(scalar)) {
+                return false;
+            }
+            value = Boolean::Box(scalar != 0);
+            return true;
+        }
+        case TAG_BYTE:
+            return reader.ReadBoxed<Byte, byte>(value);
+        case TAG_CHAR:
+            return reader.ReadBoxed<Char, zchar>(value);
+        case TAG_SHORT:
+            return reader.ReadBoxed<Short, short>(value);
+        case TAG_INT:
+            return reader.ReadBoxed<Integer, int32_t>(value);
+        case TAG_LONG: {
+            int64_t scalar = 0;
+            if (!reader.Read(scalar)) {
+                return false;
+            }
+            value = Long::Box(static_cast<long>(scalar));
+            return true;
+        }
+        case TAG_FLOAT:
+            return reader.ReadBoxed<Float, float>(value);
+        case TAG_DOUBLE:
+            return reader.ReadBoxed<Double, double>(value);
+        case TAG_STRING: {
+            std::string scalar;
+            if (!reader.ReadString(scalar)) {
+                return false;
+            }
+            value = String::Box(scalar);
+            return true;
+        }
+        case TAG_WANTPARAMS: {
+            WantParams nested;
+            if (!ReadParams(reader, nested, depth + 1)) {
+                return false;
+            }
+            value = WantParamWrapper::Box(std::move(nested));
+            return true;
+        }
+        case TAG_ARRAY:
+            return ReadArray(reader, value, depth + 1);
+        default:
+            HILOG_ERROR("Want binary has unknown tag %{public}u.", tag);
+            return false;
+    }
+}
+
+bool WantBinaryCodec::ReadArray(Reader& reader, sptr<IInterface>& value, int depth)
+{
+    uint8_t elementTag = TAG_NULL;
+    if (depth >= MAX_DEPTH || !reader.Read(elementTag)) {
+        return false;
+    }
+    if ((elementTag & BOXED_ELEMENTS) != 0) {
+        return ReadBoxedArray(reader, elementTag & ~BOXED_ELEMENTS, value, depth);
+    }
+    switch (elementTag) {
+        case TAG_BOOLEAN: {
+            std::vector<uint8_t> bytes;
+            if (!reader.ReadBlock(bytes)) {
+                return false;
+            }
+            value = Array::Pack(std::vector<bool>(bytes.begin(), bytes.end()));
+            return true;
+        }
+        case TAG_BYTE:
+            return reader.ReadPacked<byte>(value);
+        case TAG_SHORT:
+            return reader.ReadPacked<short>(value);
+        case TAG_INT:
+            return reader.ReadPacked<int>(value);
+        case TAG_LONG: {
+            std::vector<int64_t> values;
+            if (!reader.ReadBlock(values)) {
+                return false;
+            }
+            value = Array::Pack(std::vector<long>(values.begin(), values.end()));
+            return true;
+        }
+        case TAG_FLOAT:
+            return reader.ReadPacked<float>(value);
+        case TAG_DOUBLE:
+            return reader.ReadPacked<double>(value);
+        case TAG_STRING: {
+            uint32_t count = 0;
+            if (!reader.Read(count) || count > reader.Remaining() / sizeof(uint32_t)) {
+                return false;
+            }
+            std::vector<std::string> values(count);
+            for (auto& element : values) {
+                if (!reader.ReadString(element)) {
+                    return false;
+                }
+            }
+            value = Array::Pack(std::move(values));
+            return true;
+        }
+        default:
+            HILOG_ERROR("Want binary has unknown array tag %{public}u.", elementTag);
+            return false;
+    }
+}
+
+bool WantBinaryCodec::ReadBoxedArray(Reader& reader, uint8_t elementTag, sptr<IInterface>& value, int depth)
+{
+    const InterfaceID* elementId = GetElementId(elementTag);
+    uint32_t count = 0;
+    if (elementId == nullptr || !reader.Read(count) || count > reader.Remaining()) {
+        return false;
+    }
+    sptr<IArray> array = new (std::nothrow) Array(count, *elementId);
+    if (array == nullptr) {
+        return false;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        sptr<IInterface> element;
+        if (!ReadValue(reader, element, depth)) {
+            return false;
+        }
+        array->Set(i, element);
+    }
+    value = array;
+    return true;
+}
+} // namespace AAFwk
+} // namespace OHOS
@@ -18,6 +18,8 @@
 #define WANT_PARAM_USE_LONG
 #endif
 
+#include <algorithm>
+#include <atomic>
 #include <unistd.h>
 
 #include "array_wrapper.h"
@@ -76,17 +78,28 @@ std::string WantParams::GetStringByType(const sptr<IInterface> iIt, int typeId)
     }
     return "";
 }
-template<typename T1, typename T2, typename T3>
-static void SetNewArray(const AAFwk::InterfaceID &id, AAFwk::IArray *orgIArray, sptr<AAFwk::IArray> &ao);
+template<typename Params>
+static auto LowerBoundParam(Params &params, const std::string &key)
+{
+    return std::lower_bound(params.begin(), params.end(), key,
+        [](const auto &param, const std::string &key) { return param.key < key; });
+}
+
+template<typename Params>
+static auto FindParam(const Params &params, const std::string &key)
+{
+    auto it = LowerBoundParam(params, key);
+    return (it != params.end() && it->key == key) ? &*it : nullptr;
+}
+
 /**
  * @description: A constructor used to create an WantParams instance by using the parameters of an existing
  * WantParams object.
  * @param wantParams  Indicates the existing WantParams object.
  */
-WantParams::WantParams(const WantParams &wantParams)
+WantParams::WantParams(const WantParams &wantParams) : node_(wantParams.node_)
 {
-    params_.clear();
-    NewParams(wantParams, *this);
+    DupCopiedFds();
 }
 
 WantParams::WantParams(WantParams &&other) noexcept
@@ -95,84 +108,98 @@ WantParams::WantParams(WantParams &&other) noexcept
 }
 
 // inner use function
-bool WantParams::NewFds(const WantParams &source, WantParams &dest)
+const std::map<std::string, int> &WantParams::GetFds() const
+{
+    static const std::map<std::string, int> emptyFds;
+    return node_ != nullptr ? node_->fds : emptyFds;
+}
+
+// inner use function
+void WantParams::EraseParam(const std::string &key)
 {
-    // Deep copy
-    for (auto it : source.fds_) {
-        dest.fds_[it.first] = it.second;
+    ParamsNode &node = MutableNode();
+    auto &params = node.params;
+    auto it = LowerBoundParam(params, key);
+    if (it != params.end() && it->key == key) {
+        params.erase(it);
     }
-    return true;
-}  // namespace AAFwk
+    if (paramsMap_ != nullptr) {
+        paramsMap_->erase(key);
+    }
+}
 
 // inner use function
-bool WantParams::NewParams(const WantParams &source, WantParams &dest)
-{
-    // Deep copy
-    for (auto it = source.params_.begin(); it != source.params_.end(); it++) {
-        sptr<IInterface> o = it->second;
-        if (IString::Query(o) != nullptr) {
-            dest.params_[it->first] = String::Box(String::Unbox(IString::Query(o)));
-        } else if (IBoolean::Query(o) != nullptr) {
-            dest.params_[it->first] = Boolean::Box(Boolean::Unbox(IBoolean::Query(o)));
-        } else if (IByte::Query(o) != nullptr) {
-            dest.params_[it->first] = Byte::Box(Byte::Unbox(IByte::Query(o)));
-        } else if (IChar::Query(o) != nullptr) {
-            dest.params_[it->first] = Char::Box(Char::Unbox(IChar::Query(o)));
-        } else if (IShort::Query(o) != nullptr) {
-            dest.params_[it->first] = Short::Box(Short::Unbox(IShort::Query(o)));
-        } else if (IInteger::Query(o) != nullptr) {
-            dest.params_[it->first] = Integer::Box(Integer::Unbox(IInteger::Query(o)));
-        } else if (ILong::Query(o) != nullptr) {
-            dest.params_[it->first] = Long::Box(Long::Unbox(ILong::Query(o)));
-        } else if (IFloat::Query(o) != nullptr) {
-            dest.params_[it->first] = Float::Box(Float::Unbox(IFloat::Query(o)));
-        } else if (IDouble::Query(o) != nullptr) {
-            dest.params_[it->first] = Double::Box(Double::Unbox(IDouble::Query(o)));
-        } else if (IWantParams::Query(o) != nullptr) {
-            dest.params_[it->first] = WantParamWrapper::Box(WantParamWrapper::Unbox(IWantParams::Query(o)));
-        } else if (IArray::Query(o) != nullptr) {
-            sptr<IArray> destAO = nullptr;
-            if (!NewArrayData(IArray::Query(o), destAO)) {
-                continue;
+void WantParams::DetachNode() const
+{
+    // Arrays are the only stored values that can be changed in place, through IArray::Set, so the
+    // detached node gets its own arrays, like the deep copy the shared node replaces.
+    node_ = std::make_shared<ParamsNode>(*node_);
+    for (auto &param : node_->params) {
+        if (param.type == VALUE_TYPE_ARRAY) {
+            param.value = Array::Clone(IArray::Query(param.value));
+            if (paramsMap_ != nullptr) {
+                (*paramsMap_)[param.key] = param.value;
             }
-            dest.params_[it->first] = destAO;
         }
     }
-    return true;
-}  // namespace AAFwk
-// inner use
-bool WantParams::NewArrayData(IArray *source, sptr<IArray> &dest)
-{
-    if (Array::IsBooleanArray(source)) {
-        SetNewArray<bool, AAFwk::Boolean, AAFwk::IBoolean>(AAFwk::g_IID_IBoolean, source, dest);
-    } else if (Array::IsCharArray(source)) {
-        SetNewArray<char, AAFwk::Char, AAFwk::IChar>(AAFwk::g_IID_IChar, source, dest);
-    } else if (Array::IsByteArray(source)) {
-        SetNewArray<byte, AAFwk::Byte, AAFwk::IByte>(AAFwk::g_IID_IByte, source, dest);
-    } else if (Array::IsShortArray(source)) {
-        SetNewArray<short, AAFwk::Short, AAFwk::IShort>(AAFwk::g_IID_IShort, source, dest);
-    } else if (Array::IsIntegerArray(source)) {
-        SetNewArray<int, AAFwk::Integer, AAFwk::IInteger>(AAFwk::g_IID_IInteger, source, dest);
-    } else if (Array::IsLongArray(source)) {
-        SetNewArray<long, AAFwk::Long, AAFwk::ILong>(AAFwk::g_IID_ILong, source, dest);
-    } else if (Array::IsFloatArray(source)) {
-        SetNewArray<float, AAFwk::Float, AAFwk::IFloat>(AAFwk::g_IID_IFloat, source, dest);
-    } else if (Array::IsDoubleArray(source)) {
-        SetNewArray<double, AAFwk::Double, AAFwk::IDouble>(AAFwk::g_IID_IDouble, source, dest);
-    } else if (Array::IsStringArray(source)) {
-        SetNewArray<std::string, AAFwk::String, AAFwk::IString>(AAFwk::g_IID_IString, source, dest);
-    } else if (Array::IsWantParamsArray(source)) {
-        SetNewArray<WantParams, AAFwk::WantParamWrapper, AAFwk::IWantParams>(AAFwk::g_IID_IWantParams, source, dest);
-    } else {
-        return false;
+}
+
+// inner use function
+void WantParams::SyncParamsMap() const
+{
+    // The map view is only rebuilt in place, so a reference from GetParams stays valid and current.
+    if (paramsMap_ == nullptr) {
+        return;
     }
+    paramsMap_->clear();
+    for (const auto &param : GetSortedParams()) {
+        paramsMap_->emplace_hint(paramsMap_->end(), param.key, param.value);
+    }
+}
 
-    if (dest == nullptr) {
-        return false;
+// inner use function
+void WantParams::DupCopiedFds()
+{
+    // Each copy owns the fds it records, so CloseAllFd on one copy never closes the fds of another.
+    // An fd that can not be duplicated stays in the params of the copy but is not owned by it.
+    if (GetFds().empty()) {
+        return;
     }
+    std::map<std::string, int> fds;
+    fds.swap(MutableNode().fds);
+    for (auto it : fds) {
+        int dupFd = it.second > 0 ? dup(it.second) : -1;
+        if (dupFd > 0) {
+            SetFdParam(it.first, dupFd);
+        }
+    }
+}
 
-    return true;
+// inner use function
+void WantParams::SetFdParam(const std::string &key, int fd)
+{
+    WantParams wp;
+    wp.SetParam(TYPE_PROPERTY, String::Box(FD));
+    wp.SetParam(VALUE_PROPERTY, Integer::Box(fd));
+    sptr<AAFwk::IWantParams> pWantParams = AAFwk::WantParamWrapper::Box(wp);
+    SetParam(key, pWantParams);
+    MutableNode().fds[key] = fd;
 }
+
+// inner use function
+WantParams::ParamsNode &WantParams::MutableNode()
+{
+    if (node_ == nullptr) {
+        node_ = std::make_shared<ParamsNode>();
+    } else if (node_.use_count() > 1) {
+        DetachNode();
+    } else {
+        // Pairs with the release of the last other owner, whose reads must finish before writes here.
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+    return *node_;
+}
+
 /**
  * @description: A WantParams used to
  *
@@ -181,10 +208,9 @@ bool WantParams::NewArrayData(IArray *source, sptr<IArray> &dest)
 WantParams &WantParams::operator=(const WantParams &other)
 {
     if (this != &other) {
-        params_.clear();
-        fds_.clear();
-        NewParams(other, *this);
-        NewFds(other, *this);
+        node_ = other.node_;
+        SyncParamsMap();
+        DupCopiedFds();
     }
     return *this;
 }
@@ -192,34 +218,29 @@ WantParams &WantParams::operator=(const WantParams &other)
 WantParams &WantParams::operator=(WantParams &&other) noexcept
 {
     if (this != &other) {
-        // free existing resources.
-        params_.clear();
-        params_ = other.params_;
-        // free other resources.
-        other.params_.clear();
-        fds_.clear();
-        fds_ = other.fds_;
-        other.fds_.clear();
+        node_ = std::move(other.node_);
+        SyncParamsMap();
+        other.SyncParamsMap();
     }
     return *this;
 }
 
 bool WantParams::operator==(const WantParams &other)
 {
-    if (this->params_.size() != other.params_.size()) {
+    if (node_ == other.node_) {
+        return true;
+    }
+    const auto &params = GetSortedParams();
+    const auto &otherParams = other.GetSortedParams();
+    if (params.size() != otherParams.size()) {
         return false;
     }
-    for (auto itthis : this->params_) {
-        auto itother = other.params_.find(itthis.first);
-        if (itother == other.params_.end()) {
-            return false;
-        }
-        int type1 = WantParams::GetDataType(itthis.second);
-        int type2 = WantParams::GetDataType(itother->second);
-        if (type1 != type2) {
+    // Both sides are sorted by key, so equal params line up index by index.
+    for (size_t i = 0; i < params.size(); i++) {
+        if (params[i].key != otherParams[i].key || params[i].type != otherParams[i].type) {
             return false;
         }
-        if (!CompareInterface(itother->second, itthis.second, type1)) {
+        if (!CompareInterface(otherParams[i].value, params[i].value, params[i].type)) {
             return false;
         }
     }
@@ -334,7 +355,20 @@ bool WantParams::CompareInterface(const sptr<IInterface> iIt1, const sptr<IInter
  */
 void WantParams::SetParam(const std::string &key, IInterface *value)
 {
-    params_[key] = value;
+    sptr<IInterface> object = value;
+    int type = GetDataType(object);
+    auto &params = MutableNode().params;
+    if (paramsMap_ != nullptr) {
+        (*paramsMap_)[key] = object;
+    }
+    // Keys mostly arrive in order, e.g. when parsed back from ToString, appending is the fast path.
+    auto it = (params.empty() || params.back().key < key) ? params.end() : LowerBoundParam(params, key);
+    if (it != params.end() && it->key == key) {
+        it->value = object;
+        it->type = type;
+        return;
+    }
+    params.insert(it, Param { key, object, type });
 }
 
 /**
@@ -344,11 +378,19 @@ void WantParams::SetParam(const std::string &key, IInterface *value)
  */
 sptr<IInterface> WantParams::GetParam(const std::string &key) const
 {
-    auto it = params_.find(key);
-    if (it == params_.cend()) {
+    if (node_ == nullptr) {
         return nullptr;
     }
-    return it->second;
+    const Param *param = FindParam(node_->params, key);
+    if (param == nullptr) {
+        return nullptr;
+    }
+    // The caller may change an array through IArray::Set, a shared node is detached before one is handed out.
+    if (param->type == VALUE_TYPE_ARRAY && node_.use_count() > 1) {
+        DetachNode();
+        param = FindParam(node_->params, key);
+    }
+    return param->value;
 }
 
 WantParams WantParams::GetWantParams(const std::string& key) const
@@ -381,6 +423,111 @@ int WantParams::GetIntParam(const std::string& key, const int defaultValue) cons
     return defaultValue;
 }
 
+template<typename T>
+static void SetPackedArrayParam(WantParams &wantParams, const std::string &key, std::vector<T> &&value)
+{
+    sptr<IArray> ao = Array::Pack(std::move(value));
+    if (ao != nullptr) {
+        wantParams.SetParam(key, ao);
+    }
+}
+
+// inner use function, unlike GetParam it never detaches a shared node, the value must only be read.
+sptr<IInterface> WantParams::GetParamValue(const std::string &key) const
+{
+    if (node_ == nullptr) {
+        return nullptr;
+    }
+    const Param *param = FindParam(node_->params, key);
+    return param != nullptr ? param->value : nullptr;
+}
+
+template<typename T>
+static bool GetPackedArrayParam(const sptr<IInterface> &object, std::vector<T> &value)
+{
+    return Array::Unpack(IArray::Query(object), value);
+}
+
+void WantParams::SetArrayParam(const std::string &key, std::vector<bool> value)
+{
+    SetPackedArrayParam(*this, key, std::move(value));
+}
+
+void WantParams::SetArrayParam(const std::string &key, std::vector<byte> value)
+{
+    SetPackedArrayParam(*this, key, std::move(value));
+}
+
+void WantParams::SetArrayParam(const std::string &key, std::vector<short> value)
+{
+    SetPackedArrayParam(*this, key, std::move(value));
+}
+
+void WantParams::SetArrayParam(const std::string &key, std::vector<int> value)
+{
+    SetPackedArrayParam(*this, key, std::move(value));
+}
+
+void WantParams::SetArrayParam(const std::string &key, std::vector<long> value)
+{
+    SetPackedArrayParam(*this, key, std::move(value));
+}
+
+void WantParams::SetArrayParam(const std::string &key, std::vector<float> value)
+{
+    SetPackedArrayParam(*this, key, std::move(value));
+}
+
+void WantParams::SetArrayParam(const std::string &key, std::vector<double> value)
+{
+    SetPackedArrayParam(*this, key, std::move(value));
+}
+
+void WantParams::SetArrayParam(const std::string &key, std::vector<std::string> value)
+{
+    SetPackedArrayParam(*this, key, std::move(value));
+}
+
+bool WantParams::GetArrayParam(const std::string &key, std::vector<bool> &value) const
+{
+    return GetPackedArrayParam(GetParamValue(key), value);
+}
+
+bool WantParams::GetArrayParam(const std::string &key, std::vector<byte> &value) const
+{
+    return GetPackedArrayParam(GetParamValue(key), value);
+}
+
+bool WantParams::GetArrayParam(const std::string &key, std::vector<short> &value) const
+{
+    return GetPackedArrayParam(GetParamValue(key), value);
+}
+
+bool WantParams::GetArrayParam(const std::string &key, std::vector<int> &value) const
+{
+    return GetPackedArrayParam(GetParamValue(key), value);
+}
+
+bool WantParams::GetArrayParam(const std::string &key, std::vector<long> &value) const
+{
+    return GetPackedArrayParam(GetParamValue(key), value);
+}
+
+bool WantParams::GetArrayParam(const std::string &key, std::vector<float> &value) const
+{
+    return GetPackedArrayParam(GetParamValue(key), value);
+}
+
+bool WantParams::GetArrayParam(const std::string &key, std::vector<double> &value) const
+{
+    return GetPackedArrayParam(GetParamValue(key), value);
+}
+
+bool WantParams::GetArrayParam(const std::string &key, std::vector<std::string> &value) const
+{
+    return GetPackedArrayParam(GetParamValue(key), value);
+}
+
 /**
  * @description: Obtains the parameter value based on a given key.
  * @param key Indicates the key matching the parameter.
@@ -389,7 +536,25 @@ int WantParams::GetIntParam(const std::string& key, const int defaultValue) cons
 
 const std::map<std::string, sptr<IInterface>> &WantParams::GetParams() const
 {
-    return params_;
+    std::call_once(paramsMapOnce_, [this]() {
+        paramsMap_ = std::make_unique<std::map<std::string, sptr<IInterface>>>();
+        SyncParamsMap();
+    });
+    return *paramsMap_;
+}
+
+void WantParams::ForEachParam(
+    const std::function<void(const std::string &, const sptr<IInterface> &)> &visitor) const
+{
+    for (const auto &param : GetSortedParams()) {
+        visitor(param.key, param.value);
+    }
+}
+
+const std::vector<WantParams::Param> &WantParams::GetSortedParams() const
+{
+    static const std::vector<Param> emptyParams;
+    return node_ != nullptr ? node_->params : emptyParams;
 }
 
 /**
@@ -401,8 +566,8 @@ const std::set<std::string> WantParams::KeySet() const
 {
     std::set<std::string> keySet;
     keySet.clear();
-    for (auto it : params_) {
-        keySet.emplace(it.first);
+    for (const auto &param : GetSortedParams()) {
+        keySet.emplace_hint(keySet.end(), param.key);
     }
 
     return keySet;
@@ -414,7 +579,9 @@ const std::set<std::string> WantParams::KeySet() const
  */
 void WantParams::Remove(const std::string &key)
 {
-    params_.erase(key);
+    if (HasParam(key)) {
+        EraseParam(key);
+    }
 }
 
 /**
@@ -424,7 +591,7 @@ void WantParams::Remove(const std::string &key)
  */
 bool WantParams::HasParam(const std::string &key) const
 {
-    return (params_.count(key) > 0);
+    return node_ != nullptr && FindParam(node_->params, key) != nullptr;
 }
 
 /**
@@ -433,7 +600,7 @@ bool WantParams::HasParam(const std::string &key) const
  */
 int WantParams::Size() const
 {
-    return params_.size();
+    return GetSortedParams().size();
 }
 
 /**
@@ -442,97 +609,45 @@ int WantParams::Size() const
  */
 bool WantParams::IsEmpty() const
 {
-    return (params_.size() == 0);
-}
-
-template<typename dataType, typename className>
-static bool SetArray(const InterfaceID &id, const std::vector<dataType> &value, sptr<IArray> &ao)
-{
-    typename std::vector<dataType>::size_type size = value.size();
-    ao = new (std::nothrow) Array(size, id);
-    if (ao != nullptr) {
-        for (typename std::vector<dataType>::size_type i = 0; i < size; i++) {
-            ao->Set(i, className::Box(value[i]));
-        }
-        return true;
-    }
-    return false;
+    return (GetSortedParams().size() == 0);
 }
 
-template<typename T1, typename T2, typename T3>
-static void FillArray(IArray *ao, std::vector<T1> &array)
-{
-    auto func = [&](IInterface *object) {
-        if (object != nullptr) {
-            T3 *value = T3::Query(object);
-            if (value != nullptr) {
-                array.push_back(T2::Unbox(value));
-            }
-        }
-    };
-    Array::ForEach(ao, func);
-}
-// inner use template function
-template<typename T1, typename T2, typename T3>
-static void SetNewArray(const AAFwk::InterfaceID &id, AAFwk::IArray *orgIArray, sptr<AAFwk::IArray> &ao)
+void WantParams::CloseAllFd()
 {
-    if (orgIArray == nullptr) {
+    if (GetFds().empty()) {
         return;
     }
-    std::vector<T1> array;
-    auto func = [&](IInterface *object) {
-        if (object != nullptr) {
-            T3 *value = T3::Query(object);
-            if (value != nullptr) {
-                array.push_back(T2::Unbox(value));
-            }
-        }
-    };
-    Array::ForEach(orgIArray, func);
-
-    typename std::vector<T1>::size_type size = array.size();
-    if (size > 0) {
-        ao = new (std::nothrow) AAFwk::Array(size, id);
-        if (ao != nullptr) {
-            for (typename std::vector<T1>::size_type i = 0; i < size; i++) {
-                ao->Set(i, T2::Box(array[i]));
-            }
-        }
-    }
-}
-
-void WantParams::CloseAllFd()
-{
-    for (auto it : fds_) {
+    ParamsNode &node = MutableNode();
+    for (auto it : node.fds) {
         if (it.second > 0) {
             close(it.second);
         }
-        params_.erase(it.first);
+        EraseParam(it.first);
     }
-    fds_.clear();
+    node.fds.clear();
 }
 
 void WantParams::RemoveAllFd()
 {
-    for (auto it : fds_) {
-        params_.erase(it.first);
+    if (GetFds().empty()) {
+        return;
+    }
+    ParamsNode &node = MutableNode();
+    for (auto it : node.fds) {
+        EraseParam(it.first);
     }
-    fds_.clear();
+    node.fds.clear();
 }
 
 void WantParams::DupAllFd()
 {
-    for (auto it : fds_) {
+    // Iterates a snapshot, SetFdParam writes to the fds being iterated.
+    std::map<std::string, int> fds = GetFds();
+    for (auto it : fds) {
         if (it.second > 0) {
             int dupFd = dup(it.second);
             if (dupFd > 0) {
-                WantParams wp;
-                params_.erase(it.first);
-                wp.SetParam(TYPE_PROPERTY, String::Box(FD));
-                wp.SetParam(VALUE_PROPERTY, Integer::Box(dupFd));
-                sptr<AAFwk::IWantParams> pWantParams = AAFwk::WantParamWrapper::Box(wp);
-                SetParam(it.first, pWantParams);
-                fds_[it.first] = dupFd;
+                SetFdParam(it.first, dupFd);
             }
         }
     }
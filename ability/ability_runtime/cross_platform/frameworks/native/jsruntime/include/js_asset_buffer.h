@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ABILITY_RUNTIME_JS_ASSET_BUFFER_H
+#define OHOS_ABILITY_RUNTIME_JS_ASSET_BUFFER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace OHOS {
+namespace AbilityRuntime {
+/**
+ * Read-only view of an asset, either mapped straight from a file or owning a copied buffer
+ * when the asset can not be mapped (e.g. compressed inside the application package).
+ */
+class JsAssetBuffer final {
+public:
+    static std::shared_ptr<JsAssetBuffer> MapFile(const std::string& path, size_t offset = 0, size_t size = 0);
+    static std::shared_ptr<JsAssetBuffer> FromBuffer(std::vector<uint8_t>&& buffer);
+
+    JsAssetBuffer() = default;
+    ~JsAssetBuffer();
+
+    JsAssetBuffer(const JsAssetBuffer&) = delete;
+    JsAssetBuffer& operator=(const JsAssetBuffer&) = delete;
+
+    const uint8_t* GetData() const
+    {
+        return data_;
+    }
+
+    size_t GetSize() const
+    {
+        return size_;
+    }
+
+    bool IsMapped() const
+    {
+        return mapped_ != nullptr;
+    }
+
+private:
+    void* mapped_ = nullptr;
+    size_t mappedSize_ = 0;
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    std::vector<uint8_t> buffer_;
+};
+} // namespace AbilityRuntime
+} // namespace OHOS
+#endif // OHOS_ABILITY_RUNTIME_JS_ASSET_BUFFER_H
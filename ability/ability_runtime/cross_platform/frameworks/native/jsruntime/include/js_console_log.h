@@ -16,12 +16,17 @@
 #ifndef OHOS_ABILITY_RUNTIME_JS_CONSOLE_LOG_H
 #define OHOS_ABILITY_RUNTIME_JS_CONSOLE_LOG_H
 
+#include <cstdint>
+
 #include "napi/native_api.h"
 #include "native_engine/native_engine.h"
 
 namespace OHOS {
 namespace AbilityRuntime {
 void InitConsoleLogModule(napi_env env, napi_value globalObject);
+void EnableAsyncConsoleLog(bool enabled);
+void FlushConsoleLog();
+void EmitConsoleLog(uint32_t level, const char* content);
 } // namespace AbilityRuntime
 } // namespace OHOS
 #endif // OHOS_ABILITY_RUNTIME_JS_CONSOLE_LOG_H
\ No newline at end of file
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ABILITY_RUNTIME_JS_CONSOLE_LOG_DISPATCHER_H
+#define OHOS_ABILITY_RUNTIME_JS_CONSOLE_LOG_DISPATCHER_H
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace OHOS {
+namespace AbilityRuntime {
+/**
+ * Moves console log emission off the JS threads. Every JS thread writes captured log text into its
+ * own fixed ring, a single background thread drains all rings in batches and emits the hilog calls.
+ * A full ring drops the new entry and counts it, the count is logged once the ring drains.
+ * Captured entries are flushed before console.fatal and uncaught JS exceptions. Runtime teardown calls
+ * SetEnabled(false), which joins the drain thread and flushes what is left; an entry committed after
+ * that is drained by the thread that wrote it. The dispatcher is never destroyed, so nothing runs during
+ * static destruction while JS threads may still log. Entries still in the rings when the process exits
+ * without teardown, or is killed by a signal after a native crash, are lost.
+ */
+class JsConsoleLogDispatcher final {
+public:
+    static constexpr size_t RING_SIZE = 128;
+    static constexpr size_t MAX_LOG_LEN = 1024;
+
+    struct LogSlot {
+        uint32_t level = 0;
+        size_t length = 0;
+        char text[MAX_LOG_LEN] = { 0 };
+    };
+
+    static JsConsoleLogDispatcher& GetInstance();
+
+    void SetEnabled(bool enabled);
+    bool IsEnabled() const
+    {
+        return enabled_.load(std::memory_order_relaxed);
+    }
+
+    // Both must be called on the same JS thread, a null slot means the ring is full and the log is dropped.
+    LogSlot* AcquireSlot();
+    void CommitSlot();
+    void Flush();
+
+private:
+    struct LogRing {
+        std::array<LogSlot, RING_SIZE> slots;
+        std::atomic<size_t> head { 0 };
+        std::atomic<size_t> tail { 0 };
+        std::atomic<uint64_t> dropped { 0 };
+    };
+
+    JsConsoleLogDispatcher() = default;
+    ~JsConsoleLogDispatcher() = default;
+
+    JsConsoleLogDispatcher(const JsConsoleLogDispatcher&) = delete;
+    JsConsoleLogDispatcher& operator=(const JsConsoleLogDispatcher&) = delete;
+
+    LogRing& GetThreadRing();
+    void Run();
+    void DrainAll();
+    static void DrainRing(LogRing& ring);
+
+    std::atomic<bool> enabled_ { false };
+    std::atomic<bool> signaled_ { false };
+    bool stopped_ = false;
+    std::mutex stateMutex_;
+    std::mutex mutex_;
+    std::mutex drainMutex_;
+    std::condition_variable condition_;
+    std::vector<std::shared_ptr<LogRing>> rings_;
+    std::thread thread_;
+};
+} // namespace AbilityRuntime
+} // namespace OHOS
+#endif // OHOS_ABILITY_RUNTIME_JS_CONSOLE_LOG_DISPATCHER_H
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ABILITY_RUNTIME_JS_MODULE_CACHE_H
+#define OHOS_ABILITY_RUNTIME_JS_MODULE_CACHE_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace OHOS {
+namespace AppExecFwk {
+class EventHandler;
+} // namespace AppExecFwk
+namespace AbilityRuntime {
+class JsAssetBuffer;
+
+/**
+ * On-disk cache of module bytecode that survives process restarts.
+ *
+ * Every entry is keyed by module name plus a key within the module and tagged with the application
+ * version code. The bytecode is stored page aligned behind a checksummed header recording the entry size,
+ * so a warm start only checks the header page and maps the file instead of reading the module out of the
+ * application package. Entries are published with an atomic rename, a torn write is never visible.
+ * Stores are written on a background thread, and the whole cache is dropped when the version code changes.
+ * On iOS modules are plain files already, the cache is disabled there.
+ */
+class JsModuleCache final {
+public:
+    static JsModuleCache& GetInstance();
+
+    void Init(const std::string& cacheDir, uint32_t versionCode);
+    bool IsEnabled();
+    bool Load(const std::string& moduleName, const std::string& key, std::string& modulePath,
+        std::vector<uint8_t>& buffer);
+    std::shared_ptr<JsAssetBuffer> LoadMapped(
+        const std::string& moduleName, const std::string& key, std::string& modulePath);
+    void Store(const std::string& moduleName, const std::string& key, const std::string& modulePath,
+        const std::shared_ptr<JsAssetBuffer>& assetBuffer);
+    void InvalidateModule(const std::string& moduleName);
+
+private:
+    JsModuleCache() = default;
+    ~JsModuleCache() = default;
+
+    JsModuleCache(const JsModuleCache&) = delete;
+    JsModuleCache& operator=(const JsModuleCache&) = delete;
+
+    std::string GetModuleDir(const std::string& moduleName) const;
+    std::string GetEntryPath(const std::string& moduleName, const std::string& key) const;
+    int OpenEntry(const std::string& entryPath, const std::string& key, std::string& modulePath,
+        uint64_t& dataOffset, uint64_t& dataSize);
+    void RecordLoad(const std::string& key, bool hit, int64_t beginTime);
+
+    std::mutex mutex_;
+    std::shared_ptr<AppExecFwk::EventHandler> writeHandler_;
+    std::string cacheDir_;
+    uint32_t versionCode_ = 0;
+    uint32_t hitCount_ = 0;
+    uint32_t missCount_ = 0;
+};
+} // namespace AbilityRuntime
+} // namespace OHOS
+#endif // OHOS_ABILITY_RUNTIME_JS_MODULE_CACHE_H
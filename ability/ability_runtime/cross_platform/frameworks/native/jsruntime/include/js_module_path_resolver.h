@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ABILITY_RUNTIME_JS_MODULE_PATH_RESOLVER_H
+#define OHOS_ABILITY_RUNTIME_JS_MODULE_PATH_RESOLVER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace OHOS {
+namespace AbilityRuntime {
+/**
+ * Turns (module name, source entrance) pairs into .abc file paths without std::regex.
+ */
+class JsModulePathResolver final {
+public:
+    JsModulePathResolver() = delete;
+
+    static std::string RemoveCurrentDirSegments(const std::string& path);
+    static std::string ResolveAbcPath(const std::string& moduleName, const std::string& srcEntrance);
+};
+
+/**
+ * Process wide LRU of resolved HSP module names keyed by (referrer, specifier).
+ *
+ * Every engine, the main one and each worker's, asks JsModuleReader to resolve the same HSP imports again.
+ * Entries are tagged with the StageAssetManager module generation, a module update drops all of them.
+ */
+class JsModuleResolutionCache final {
+public:
+    static constexpr size_t CAPACITY = 256;
+
+    static JsModuleResolutionCache& GetInstance();
+
+    bool Get(const std::string& referrer, const std::string& specifier, uint64_t generation, std::string& resolved);
+    void Put(const std::string& referrer, const std::string& specifier, uint64_t generation,
+        const std::string& resolved);
+
+private:
+    using Entry = std::pair<std::string, std::string>;
+
+    JsModuleResolutionCache() = default;
+    ~JsModuleResolutionCache() = default;
+
+    JsModuleResolutionCache(const JsModuleResolutionCache&) = delete;
+    JsModuleResolutionCache& operator=(const JsModuleResolutionCache&) = delete;
+
+    static std::string MakeKey(const std::string& referrer, const std::string& specifier);
+    void ResetIfStale(uint64_t generation);
+
+    std::mutex mutex_;
+    uint64_t generation_ = 0;
+    std::list<Entry> entries_;
+    std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+};
+} // namespace AbilityRuntime
+} // namespace OHOS
+#endif // OHOS_ABILITY_RUNTIME_JS_MODULE_PATH_RESOLVER_H
@@ -16,14 +16,15 @@
 #ifndef OHOS_ABILITY_RUNTIME_JS_MODULE_READER_H
 #define OHOS_ABILITY_RUNTIME_JS_MODULE_READER_H
 
+#include <memory>
 #include <sstream>
 #include <string>
 #include <vector>
 
-
-
 namespace OHOS {
 namespace AbilityRuntime {
+class JsAssetBuffer;
+
 class JsModuleReader {
 public:
 
@@ -41,7 +42,7 @@ private:
     std::string GetModuleName(const std::string& inputPath) const;
 
     std::string bundleName_;
-    std::vector<uint8_t> moduleBuffer_;
+    std::shared_ptr<JsAssetBuffer> moduleBuffer_;
 };
 } // namespace AbilityRuntime
 } // namespace OHOS
@@ -26,7 +26,6 @@
 #include "js_module_reader.h"
 #include "native_engine/native_engine.h"
 #include "runtime.h"
-#include "js_module_reader.h"
 
 class NativeEngine;
 namespace OHOS {
@@ -41,6 +40,7 @@ class NapiUncaughtExceptionCallback;
 
 namespace AbilityRuntime {
 class TimerTask;
+class JsTimerWheel;
 class ModSourceMap;
 
 inline void* DetachCallbackFunc(napi_env env, void* value, void*)
@@ -71,6 +71,10 @@ public:
         const std::string& moduleName, napi_value* const* argv = nullptr, size_t argc = 0);
     void PostTask(const std::function<void()>& task, const std::string& name, int64_t delayTime);
     void RemoveTask(const std::string& name);
+    std::shared_ptr<JsTimerWheel> GetTimerWheel() const
+    {
+        return timerWheel_;
+    }
     virtual bool RunScript(const std::string& path, const std::string& hapPath, bool useCommonChunk = false) = 0;
     void StartDebugMode(bool needBreakPoint);
     bool StartDebugMode(const std::string& bundleName, bool needBreakPoint, uint32_t instanceId,
@@ -105,6 +109,7 @@ protected:
     std::string moduleName_;
     std::unique_ptr<NativeReference> methodRequireNapiRef_;
     std::shared_ptr<AppExecFwk::EventHandler> eventHandler_;
+    std::shared_ptr<JsTimerWheel> timerWheel_;
     std::unordered_map<std::string, NativeReference*> modules_;
     static std::atomic<bool> hasInstance;
 
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ABILITY_RUNTIME_JS_TIMER_WHEEL_H
+#define OHOS_ABILITY_RUNTIME_JS_TIMER_WHEEL_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "native_engine/native_engine.h"
+
+namespace OHOS {
+namespace AbilityRuntime {
+class JsRuntime;
+
+/**
+ * Hashed timer wheel backing the JS setTimeout/setInterval functions.
+ *
+ * The wheel owns the callbacks of every pending timer and keeps a single "timers due" task in the
+ * event runner of the js runtime. All methods must be called on the js thread.
+ */
+class JsTimerWheel final : public std::enable_shared_from_this<JsTimerWheel> {
+public:
+    explicit JsTimerWheel(JsRuntime& jsRuntime);
+    ~JsTimerWheel() = default;
+
+    JsTimerWheel(const JsTimerWheel&) = delete;
+    JsTimerWheel& operator=(const JsTimerWheel&) = delete;
+
+    uint32_t AddTimer(const std::shared_ptr<NativeReference>& jsFunction,
+        std::vector<std::shared_ptr<NativeReference>>&& jsArgs, int64_t delayTime, bool isInterval);
+    void RemoveTimer(uint32_t timerId);
+    void Clear();
+
+private:
+    static constexpr size_t WHEEL_SIZE = 512;
+    static constexpr int64_t WHEEL_MASK = static_cast<int64_t>(WHEEL_SIZE) - 1;
+
+    struct TimerEntry {
+        std::shared_ptr<NativeReference> jsFunction;
+        std::vector<std::shared_ptr<NativeReference>> jsArgs;
+        int64_t interval = 0;
+        int64_t expireTime = 0;
+        bool isInterval = false;
+        int32_t containerScopeId = 0;
+    };
+
+    static int64_t GetCurrentTime();
+    void InsertToSlot(uint32_t timerId, int64_t expireTime);
+    void OnTimersDue();
+    void Dispatch(uint32_t timerId, int64_t now);
+    static int64_t GetNextExpireTime(const TimerEntry& entry, int64_t now);
+    void ScheduleDueTask();
+    int64_t GetNearestExpireTime() const;
+
+    JsRuntime& jsRuntime_;
+    std::unordered_map<uint32_t, TimerEntry> timers_;
+    std::array<std::vector<uint32_t>, WHEEL_SIZE> slots_;
+    uint32_t nextTimerId_ = 1;
+    int64_t currentTime_ = 0;
+    int64_t scheduledTime_ = -1;
+    bool dispatching_ = false;
+};
+} // namespace AbilityRuntime
+} // namespace OHOS
+#endif // OHOS_ABILITY_RUNTIME_JS_TIMER_WHEEL_H
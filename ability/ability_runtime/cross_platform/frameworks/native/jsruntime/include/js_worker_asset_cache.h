@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ABILITY_RUNTIME_JS_WORKER_ASSET_CACHE_H
+#define OHOS_ABILITY_RUNTIME_JS_WORKER_ASSET_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace OHOS {
+namespace AbilityRuntime {
+class JsAssetBuffer;
+
+/**
+ * Keeps the scripts of recently started workers loaded on Android, so starting the same worker again
+ * shares the copy instead of decompressing the asset out of the apk once more. This is a script cache,
+ * not a pool of pre-started engines. It holds at most CAPACITY scripts and CAPACITY_BYTES in total, a
+ * script larger than that is never cached. Entries are keyed by "moduleName/..." paths and dropped with
+ * InvalidateModule when that module is dynamically updated.
+ */
+class JsWorkerAssetCache final {
+public:
+    static constexpr size_t CAPACITY = 8;
+    static constexpr size_t CAPACITY_BYTES = 4 * 1024 * 1024;
+
+    static JsWorkerAssetCache& GetInstance();
+
+    std::shared_ptr<JsAssetBuffer> Get(const std::string& path);
+    void Put(const std::string& path, const std::shared_ptr<JsAssetBuffer>& assetBuffer);
+    void InvalidateModule(const std::string& moduleName);
+
+private:
+    JsWorkerAssetCache() = default;
+    ~JsWorkerAssetCache() = default;
+
+    JsWorkerAssetCache(const JsWorkerAssetCache&) = delete;
+    JsWorkerAssetCache& operator=(const JsWorkerAssetCache&) = delete;
+
+    using Entry = std::pair<std::string, std::shared_ptr<JsAssetBuffer>>;
+
+    void EraseEntry(std::list<Entry>::iterator it);
+
+    std::mutex mutex_;
+    size_t totalBytes_ = 0;
+    std::list<Entry> entries_;
+    std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+    uint32_t hitCount_ = 0;
+    uint32_t missCount_ = 0;
+};
+} // namespace AbilityRuntime
+} // namespace OHOS
+#endif // OHOS_ABILITY_RUNTIME_JS_WORKER_ASSET_CACHE_H
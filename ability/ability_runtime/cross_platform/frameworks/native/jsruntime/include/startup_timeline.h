@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ABILITY_RUNTIME_STARTUP_TIMELINE_H
+#define OHOS_ABILITY_RUNTIME_STARTUP_TIMELINE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace OHOS {
+namespace AbilityRuntime {
+struct StartupPhaseRecord {
+    std::string name;
+    int64_t beginTime = 0;
+    int64_t endTime = 0;
+    uint32_t threadIndex = 0;
+    uint32_t depth = 0;
+};
+
+/**
+ * Records named startup phases from any thread into a fixed buffer, with monotonic timestamps in
+ * microseconds relative to the launch. Phases beyond the capacity are dropped, recording never allocates.
+ */
+class StartupTimeline final {
+public:
+    static constexpr size_t MAX_PHASE_COUNT = 256;
+    static constexpr size_t MAX_NAME_LENGTH = 48;
+
+    static StartupTimeline& GetInstance();
+    static int64_t GetNowMicroseconds();
+
+    // Restarts the timeline, must be called before any other thread records a phase.
+    void Start();
+    void Record(const std::string& name, int64_t beginTime, int64_t endTime, uint32_t depth = 0);
+    int64_t GetElapsedTime() const;
+    std::vector<StartupPhaseRecord> GetPhases() const;
+    std::string ExportJson() const;
+    std::string ExportChromeTrace() const;
+
+private:
+    StartupTimeline() = default;
+    ~StartupTimeline() = default;
+
+    StartupTimeline(const StartupTimeline&) = delete;
+    StartupTimeline& operator=(const StartupTimeline&) = delete;
+
+    struct PhaseSlot {
+        char name[MAX_NAME_LENGTH] = { 0 };
+        int64_t beginTime = 0;
+        int64_t endTime = 0;
+        uint32_t threadIndex = 0;
+        uint32_t depth = 0;
+        std::atomic<bool> committed { false };
+    };
+
+    std::array<PhaseSlot, MAX_PHASE_COUNT> slots_;
+    std::atomic<size_t> nextSlot_ { 0 };
+    std::atomic<int64_t> startTime_ { 0 };
+};
+
+/**
+ * Records the enclosing scope as a startup phase. Phases opened inside it on the same thread are
+ * exported as its sub-phases.
+ */
+class StartupPhase final {
+public:
+    explicit StartupPhase(const std::string& name);
+    ~StartupPhase();
+
+    StartupPhase(const StartupPhase&) = delete;
+    StartupPhase& operator=(const StartupPhase&) = delete;
+
+private:
+    std::string name_;
+    int64_t beginTime_ = 0;
+    uint32_t depth_ = 0;
+};
+} // namespace AbilityRuntime
+} // namespace OHOS
+#endif // OHOS_ABILITY_RUNTIME_STARTUP_TIMELINE_H
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "js_asset_buffer.h"
+
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "hilog.h"
+
+namespace OHOS {
+namespace AbilityRuntime {
+std::shared_ptr<JsAssetBuffer> JsAssetBuffer::MapFile(const std::string& path, size_t offset, size_t size)
+{
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        HILOG_ERROR("JsAssetBuffer open failed: %{private}s, errno: %{public}d.", path.c_str(), errno);
+        return nullptr;
+    }
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || static_cast<size_t>(fileStat.st_size) <= offset) {
+        HILOG_ERROR("JsAssetBuffer invalid file: %{private}s.", path.c_str());
+        close(fd);
+        return nullptr;
+    }
+    size_t fileSize = static_cast<size_t>(fileStat.st_size);
+    if (size == 0 || offset + size > fileSize) {
+        size = fileSize - offset;
+    }
+
+    // mmap offsets must be page aligned, keep the leading bytes of the page in the mapping.
+    size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t alignedOffset = offset / pageSize * pageSize;
+    size_t mappedSize = size + (offset - alignedOffset);
+    void* mapped = mmap(nullptr, mappedSize, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(alignedOffset));
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        HILOG_ERROR("JsAssetBuffer mmap failed: %{private}s, errno: %{public}d.", path.c_str(), errno);
+        return nullptr;
+    }
+
+    auto assetBuffer = std::make_shared<JsAssetBuffer>();
+    assetBuffer->mapped_ = mapped;
+    assetBuffer->mappedSize_ = mappedSize;
+    assetBuffer->data_ = static_cast<const uint8_t*>(mapped) + (offset - alignedOffset);
+    assetBuffer->size_ = size;
+    return assetBuffer;
+}
+
+std::shared_ptr<JsAssetBuffer> JsAssetBuffer::FromBuffer(std::vector<uint8_t>&& buffer)
+{
+    auto assetBuffer = std::make_shared<JsAssetBuffer>();
+    assetBuffer->buffer_ = std::move(buffer);
+    assetBuffer->data_ = assetBuffer->buffer_.data();
+    assetBuffer->size_ = assetBuffer->buffer_.size();
+    return assetBuffer;
+}
+
+JsAssetBuffer::~JsAssetBuffer()
+{
+    if (mapped_ != nullptr) {
+        munmap(mapped_, mappedSize_);
+        mapped_ = nullptr;
+    }
+}
+} // namespace AbilityRuntime
+} // namespace OHOS
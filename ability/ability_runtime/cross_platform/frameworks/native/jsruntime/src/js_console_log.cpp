@@ -19,6 +19,7 @@
 
 #include "hilog.h"
 #include "napi/native_common.h"
+#include "js_console_log_dispatcher.h"
 #include "js_runtime_utils.h"
 
 namespace OHOS {
@@ -34,52 +35,94 @@ enum class LogLevel : uint32_t {
     FATAL,
 };
 
-std::string MakeLogContent(napi_env env, napi_callback_info info)
+napi_value GetLogString(napi_env env, napi_value value, size_t& length)
+{
+    if (!CheckTypeForNapiValue(env, value, napi_string)) {
+        napi_value resultStr = nullptr;
+        napi_coerce_to_string(env, value, &resultStr);
+        value = resultStr;
+    }
+
+    if (value == nullptr) {
+        HILOG_ERROR("Failed to convert to string object");
+        return nullptr;
+    }
+
+    length = 0;
+    napi_status status = napi_get_value_string_utf8(env, value, nullptr, 0, &length);
+    if (status != napi_ok || length == 0 || length >= JS_CONSOLE_LOG_MAX_LOG_LEN) {
+        HILOG_DEBUG("Log length exceeds maximum");
+        length = 0;
+    }
+    return value;
+}
+
+struct LogArgs {
+    napi_value values[ARGC_MAX_COUNT] = { nullptr };
+    size_t lengths[ARGC_MAX_COUNT] = { 0 };
+    size_t count = 0;
+    size_t totalLength = 0;
+};
+
+// Converts every argument once, each one is limited to JS_CONSOLE_LOG_MAX_LOG_LEN on its own.
+void CollectLogArgs(napi_env env, napi_callback_info info, LogArgs& args)
 {
-    std::string content;
-    
     size_t argc = ARGC_MAX_COUNT;
     napi_value argv[ARGC_MAX_COUNT] = {nullptr};
-    NAPI_CALL(env, napi_get_cb_info(env, info, &argc, argv, nullptr, nullptr));
+    if (napi_get_cb_info(env, info, &argc, argv, nullptr, nullptr) != napi_ok) {
+        return;
+    }
 
     for (size_t i = 0; i < argc; i++) {
-        napi_value value = argv[i];
-        if (!CheckTypeForNapiValue(env, value, napi_string)) {
-            napi_value resultStr = nullptr;
-            napi_coerce_to_string(env, value, &resultStr);
-            value = resultStr;
-        }
-
+        size_t bufferLen = 0;
+        napi_value value = GetLogString(env, argv[i], bufferLen);
         if (value == nullptr) {
-            HILOG_ERROR("Failed to convert to string object");
             continue;
         }
-
-        size_t bufferLen = 0;
-        napi_status status = napi_get_value_string_utf8(env, value, nullptr, 0, &bufferLen);
-        if (status != napi_ok || bufferLen == 0 || bufferLen >= JS_CONSOLE_LOG_MAX_LOG_LEN) {
-            HILOG_DEBUG("Log length exceeds maximum");
-            return content;
-        }
-
-        auto buff = new (std::nothrow) char[bufferLen + 1];
-        if (buff == nullptr) {
-            HILOG_ERROR("Failed to allocate buffer, size = %zu", bufferLen + 1);
-            break;
+        if (bufferLen == 0) {
+            return;
         }
+        args.totalLength += (args.count > 0 ? 1 : 0) + bufferLen;
+        args.values[args.count] = value;
+        args.lengths[args.count] = bufferLen;
+        ++args.count;
+    }
+}
 
-        size_t strLen = 0;
-        napi_get_value_string_utf8(env, value, buff, bufferLen + 1, &strLen);
-        if (!content.empty()) {
+std::string MakeLogContent(napi_env env, const LogArgs& args)
+{
+    std::string content;
+    content.reserve(args.totalLength + 1);
+    for (size_t i = 0; i < args.count; i++) {
+        if (i > 0) {
             content.append(" ");
         }
-        content.append(buff);
-        delete [] buff;
+        // Copy straight into the content, the terminator written by napi lands on the extra byte.
+        size_t offset = content.size();
+        content.resize(offset + args.lengths[i] + 1);
+        size_t strLen = 0;
+        napi_get_value_string_utf8(env, args.values[i], &content[offset], args.lengths[i] + 1, &strLen);
+        content.resize(offset + strLen);
     }
-
     return content;
 }
 
+// Writes the arguments into the slot of the calling thread's ring, the caller checked that they fit.
+void CaptureLogContent(napi_env env, const LogArgs& args, JsConsoleLogDispatcher::LogSlot& slot)
+{
+    slot.length = 0;
+    slot.text[0] = '\0';
+    for (size_t i = 0; i < args.count; i++) {
+        if (i > 0) {
+            slot.text[slot.length++] = ' ';
+        }
+        size_t strLen = 0;
+        napi_get_value_string_utf8(env, args.values[i], slot.text + slot.length, sizeof(slot.text) - slot.length,
+            &strLen);
+        slot.length += strLen;
+    }
+}
+
 template<LogLevel LEVEL>
 napi_value ConsoleLog(napi_env env, napi_callback_info info)
 {
@@ -88,31 +131,63 @@ napi_value ConsoleLog(napi_env env, napi_callback_info info)
         return nullptr;
     }
 
-    std::string content = MakeLogContent(env, info);
-    switch (LEVEL) {
+    LogArgs args;
+    CollectLogArgs(env, info, args);
+    auto& dispatcher = JsConsoleLogDispatcher::GetInstance();
+    bool isAsync = LEVEL != LogLevel::FATAL && dispatcher.IsEnabled();
+    if (isAsync && args.totalLength < JsConsoleLogDispatcher::MAX_LOG_LEN) {
+        auto slot = dispatcher.AcquireSlot();
+        if (slot != nullptr) {
+            slot->level = static_cast<uint32_t>(LEVEL);
+            CaptureLogContent(env, args, *slot);
+            dispatcher.CommitSlot();
+        }
+        return CreateJsUndefined(env);
+    }
+
+    // Fatal logs, and logs too long for a slot, are emitted synchronously after everything captured before them.
+    std::string content = MakeLogContent(env, args);
+    if (LEVEL == LogLevel::FATAL || isAsync) {
+        dispatcher.Flush();
+    }
+    EmitConsoleLog(static_cast<uint32_t>(LEVEL), content.c_str());
+    return CreateJsUndefined(env);
+}
+} // namespace
+
+void EmitConsoleLog(uint32_t level, const char* content)
+{
+    switch (static_cast<LogLevel>(level)) {
         case LogLevel::INFO:
-            HILOG_INFO("%{public}s", content.c_str());
+            HILOG_INFO("%{public}s", content);
             break;
         case LogLevel::DEBUG:
-            HILOG_DEBUG("%{public}s", content.c_str());
+            HILOG_DEBUG("%{public}s", content);
             break;
         case LogLevel::WARN:
-            HILOG_WARN("%{public}s", content.c_str());
+            HILOG_WARN("%{public}s", content);
             break;
         case LogLevel::ERROR:
-            HILOG_ERROR("%{public}s", content.c_str());
+            HILOG_ERROR("%{public}s", content);
             break;
         case LogLevel::FATAL:
-            HILOG_FATAL("%{public}s", content.c_str());
+            HILOG_FATAL("%{public}s", content);
             break;
         default:
-            HILOG_INFO("%{public}s", content.c_str());
+            HILOG_INFO("%{public}s", content);
             break;
     }
+}
 
-    return CreateJsUndefined(env);
+void EnableAsyncConsoleLog(bool enabled)
+{
+    JsConsoleLogDispatcher::GetInstance().SetEnabled(enabled);
+}
+
+void FlushConsoleLog()
+{
+    JsConsoleLogDispatcher::GetInstance().Flush();
 }
-} // namespace
 
 void InitConsoleLogModule(napi_env env, napi_value globalObject)
 {
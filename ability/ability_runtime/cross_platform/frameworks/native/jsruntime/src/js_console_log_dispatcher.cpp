@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "js_console_log_dispatcher.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "hilog.h"
+#include "js_console_log.h"
+
+namespace OHOS {
+namespace AbilityRuntime {
+namespace {
+constexpr std::chrono::milliseconds DRAIN_INTERVAL(20);
+}
+
+JsConsoleLogDispatcher& JsConsoleLogDispatcher::GetInstance()
+{
+    // Intentionally leaked, JS threads may still log while static objects are destroyed at exit.
+    static JsConsoleLogDispatcher* instance = new JsConsoleLogDispatcher();
+    return *instance;
+}
+
+void JsConsoleLogDispatcher::SetEnabled(bool enabled)
+{
+    std::lock_guard<std::mutex> stateLock(stateMutex_);
+    if (enabled) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopped_ = false;
+        }
+        if (!thread_.joinable()) {
+            thread_ = std::thread(&JsConsoleLogDispatcher::Run, this);
+        }
+        enabled_.store(true, std::memory_order_seq_cst);
+        return;
+    }
+
+    enabled_.store(false, std::memory_order_seq_cst);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopped_ = true;
+    }
+    condition_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    // Pairs with CommitSlot, either this drain sees a racing entry or its writer sees the dispatcher disabled.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    DrainAll();
+}
+
+JsConsoleLogDispatcher::LogRing& JsConsoleLogDispatcher::GetThreadRing()
+{
+    // The dispatcher co-owns the ring, so entries written right before a worker exits are still drained.
+    thread_local std::shared_ptr<LogRing> ring;
+    if (ring == nullptr) {
+        ring = std::make_shared<LogRing>();
+        std::lock_guard<std::mutex> lock(mutex_);
+        rings_.emplace_back(ring);
+    }
+    return *ring;
+}
+
+JsConsoleLogDispatcher::LogSlot* JsConsoleLogDispatcher::AcquireSlot()
+{
+    auto& ring = GetThreadRing();
+    size_t tail = ring.tail.load(std::memory_order_relaxed);
+    if (tail - ring.head.load(std::memory_order_acquire) >= RING_SIZE) {
+        ring.dropped.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    return &ring.slots[tail % RING_SIZE];
+}
+
+void JsConsoleLogDispatcher::CommitSlot()
+{
+    auto& ring = GetThreadRing();
+    ring.tail.store(ring.tail.load(std::memory_order_relaxed) + 1, std::memory_order_seq_cst);
+    // Disabled since the slot was acquired, the final drain may have missed this entry.
+    if (!enabled_.load(std::memory_order_seq_cst)) {
+        Flush();
+        return;
+    }
+    if (!signaled_.exchange(true, std::memory_order_acq_rel)) {
+        condition_.notify_one();
+    }
+}
+
+void JsConsoleLogDispatcher::Flush()
+{
+    DrainAll();
+}
+
+void JsConsoleLogDispatcher::Run()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopped_) {
+        // A wakeup lost between the flag check and the wait only delays the batch by one interval.
+        condition_.wait_for(lock, DRAIN_INTERVAL,
+            [this]() { return stopped_ || signaled_.load(std::memory_order_acquire); });
+        signaled_.store(false, std::memory_order_release);
+        lock.unlock();
+        DrainAll();
+        lock.lock();
+    }
+}
+
+void JsConsoleLogDispatcher::DrainAll()
+{
+    std::lock_guard<std::mutex> drainLock(drainMutex_);
+    std::vector<std::shared_ptr<LogRing>> rings;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        rings = rings_;
+    }
+    for (const auto& ring : rings) {
+        DrainRing(*ring);
+    }
+    rings.clear();
+
+    // Rings whose thread exited are released once they are empty.
+    std::lock_guard<std::mutex> lock(mutex_);
+    rings_.erase(std::remove_if(rings_.begin(), rings_.end(), [](const std::shared_ptr<LogRing>& ring) {
+        return ring.use_count() == 1 &&
+            ring->head.load(std::memory_order_relaxed) == ring->tail.load(std::memory_order_acquire);
+    }), rings_.end());
+}
+
+void JsConsoleLogDispatcher::DrainRing(LogRing& ring)
+{
+    size_t head = ring.head.load(std::memory_order_relaxed);
+    size_t tail = ring.tail.load(std::memory_order_acquire);
+    for (; head != tail; ++head) {
+        const auto& slot = ring.slots[head % RING_SIZE];
+        EmitConsoleLog(slot.level, slot.text);
+        ring.head.store(head + 1, std::memory_order_release);
+    }
+    uint64_t dropped = ring.dropped.exchange(0, std::memory_order_relaxed);
+    if (dropped > 0) {
+        HILOG_WARN("%{public}llu console logs dropped", static_cast<unsigned long long>(dropped));
+    }
+}
+} // namespace AbilityRuntime
+} // namespace OHOS
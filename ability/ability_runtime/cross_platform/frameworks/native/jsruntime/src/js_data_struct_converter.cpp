@@ -15,6 +15,9 @@
 
 #include "js_data_struct_converter.h"
 
+#include <array>
+#include <unordered_map>
+
 #include "hilog.h"
 #include "js_runtime_utils.h"
 #include "resource_manager_addon.h"
@@ -22,94 +25,226 @@
 namespace OHOS {
 namespace AbilityRuntime {
 using namespace OHOS::AppExecFwk;
+namespace {
+enum PropertyKey : size_t {
+    KEY_BUNDLE_NAME,
+    KEY_MODULE_NAME,
+    KEY_NAME,
+    KEY_LABEL,
+    KEY_LABEL_ID,
+    KEY_DESCRIPTION,
+    KEY_DESCRIPTION_ID,
+    KEY_ICON,
+    KEY_ICON_ID,
+    KEY_TYPE,
+    KEY_LAUNCH_TYPE,
+    KEY_APPLICATION_INFO,
+    KEY_METADATA,
+    KEY_VALUE,
+    KEY_RESOURCE,
+    KEY_CODE_PATH,
+    KEY_SYSTEM_APP,
+    KEY_MAIN_ELEMENT_NAME,
+    KEY_ABILITIES_INFO,
+    KEY_LANGUAGE,
+    KEY_COLOR_MODE,
+    KEY_DIRECTION,
+    KEY_SCREEN_DENSITY,
+    KEY_FONT_SIZE_SCALE,
+    KEY_PROCESS_NAME,
+    KEY_PID,
+    KEY_BUNDLE_NAMES,
+    KEY_LAUNCH_REASON,
+    KEY_LAST_EXIT_REASON,
+    KEY_COUNT,
+};
 
-napi_value CreateJsAbilityInfo(napi_env env, const AppExecFwk::AbilityInfo& abilityInfo)
+constexpr const char* PROPERTY_KEY_NAMES[KEY_COUNT] = {
+    "bundleName",
+    "moduleName",
+    "name",
+    "label",
+    "labelId",
+    "description",
+    "descriptionId",
+    "icon",
+    "iconId",
+    "type",
+    "launchType",
+    "applicationInfo",
+    "metadata",
+    "value",
+    "resource",
+    "codePath",
+    "systemApp",
+    "mainElementName",
+    "abilitiesInfo",
+    "language",
+    "colorMode",
+    "direction",
+    "screenDensity",
+    "fontSizeScale",
+    "processName",
+    "pid",
+    "bundleNames",
+    "launchReason",
+    "lastExitReason",
+};
+
+constexpr size_t MAX_OBJECT_PROPERTIES = 16;
+constexpr napi_property_attributes JS_PROPERTY_ATTRIBUTES =
+    static_cast<napi_property_attributes>(napi_writable | napi_enumerable | napi_configurable);
+
+// Property names are created once per env and kept alive by references until the env is destroyed.
+using PropertyKeyRefs = std::array<napi_ref, KEY_COUNT>;
+thread_local std::unordered_map<napi_env, PropertyKeyRefs> g_propertyKeyRefs;
+
+void ReleasePropertyKeys(void* data)
 {
-    HILOG_INFO("CreateJsAbilityInfo call.");
-    napi_value object = nullptr;
-    napi_create_object(env, &object);
-    if (object == nullptr) {
-        HILOG_ERROR("Create object failed.");
-        return nullptr;
+    napi_env env = static_cast<napi_env>(data);
+    auto it = g_propertyKeyRefs.find(env);
+    if (it == g_propertyKeyRefs.end()) {
+        return;
+    }
+    for (napi_ref ref : it->second) {
+        if (ref != nullptr) {
+            napi_delete_reference(env, ref);
+        }
+    }
+    g_propertyKeyRefs.erase(it);
+}
+
+napi_value GetPropertyKey(napi_env env, PropertyKey key)
+{
+    auto it = g_propertyKeyRefs.find(env);
+    if (it == g_propertyKeyRefs.end()) {
+        it = g_propertyKeyRefs.emplace(env, PropertyKeyRefs {}).first;
+        napi_add_env_cleanup_hook(env, ReleasePropertyKeys, env);
+    }
+    napi_ref& ref = it->second[key];
+    napi_value result = nullptr;
+    if (ref != nullptr) {
+        napi_get_reference_value(env, ref, &result);
+        return result;
+    }
+    napi_create_string_utf8(env, PROPERTY_KEY_NAMES[key], NAPI_AUTO_LENGTH, &result);
+    if (result != nullptr) {
+        napi_create_reference(env, result, 1, &ref);
+    }
+    return result;
+}
+
+// Collects the properties of an object and defines them all with a single napi_define_properties call.
+class JsObjectBuilder final {
+public:
+    explicit JsObjectBuilder(napi_env env) : env_(env) {}
+
+    template<class T>
+    JsObjectBuilder& Set(PropertyKey key, const T& value)
+    {
+        return SetValue(key, CreateJsValue(env_, value));
+    }
+
+    JsObjectBuilder& SetValue(PropertyKey key, napi_value value)
+    {
+        if (value == nullptr) {
+            return *this;
+        }
+        if (count_ >= MAX_OBJECT_PROPERTIES) {
+            HILOG_ERROR("Too many properties, drop %{public}s.", PROPERTY_KEY_NAMES[key]);
+            return *this;
+        }
+        napi_property_descriptor& descriptor = descriptors_[count_++];
+        descriptor = {};
+        descriptor.name = GetPropertyKey(env_, key);
+        if (descriptor.name == nullptr) {
+            descriptor.utf8name = PROPERTY_KEY_NAMES[key];
+        }
+        descriptor.value = value;
+        descriptor.attributes = JS_PROPERTY_ATTRIBUTES;
+        return *this;
+    }
+
+    napi_value Build()
+    {
+        napi_value object = nullptr;
+        napi_create_object(env_, &object);
+        if (object == nullptr) {
+            HILOG_ERROR("Create object failed.");
+            return nullptr;
+        }
+        if (count_ > 0) {
+            napi_define_properties(env_, object, count_, descriptors_.data());
+        }
+        return object;
     }
 
-    napi_set_named_property(env, object, "bundleName", CreateJsValue(env, abilityInfo.bundleName));
-    napi_set_named_property(env, object, "moduleName", CreateJsValue(env, abilityInfo.moduleName));
-    napi_set_named_property(env, object, "name", CreateJsValue(env, abilityInfo.name));
-    napi_set_named_property(env, object, "label", CreateJsValue(env, abilityInfo.label));
-    napi_set_named_property(env, object, "labelId", CreateJsValue(env, abilityInfo.labelId));
-    napi_set_named_property(env, object, "description", CreateJsValue(env, abilityInfo.description));
-    napi_set_named_property(env, object, "descriptionId", CreateJsValue(env, abilityInfo.descriptionId));
-    napi_set_named_property(env, object, "icon", CreateJsValue(env, abilityInfo.iconPath));
-    napi_set_named_property(env, object, "iconId", CreateJsValue(env, abilityInfo.iconId));
-    napi_set_named_property(env, object, "type", CreateJsValue(env, abilityInfo.type));
-    napi_set_named_property(env, object, "launchType", CreateJsValue(env, abilityInfo.launchMode));
-    napi_set_named_property(
-        env, object, "applicationInfo", CreateJsApplicationInfo(env, abilityInfo.applicationInfo));
-        
+private:
+    napi_env env_ = nullptr;
+    size_t count_ = 0;
+    std::array<napi_property_descriptor, MAX_OBJECT_PROPERTIES> descriptors_;
+};
+
+napi_value CreateJsMetadataArray(napi_env env, const std::vector<Metadata>& metadatas)
+{
     napi_value metadataArray = nullptr;
-    napi_create_array_with_length(env, abilityInfo.metadata.size(), &metadataArray);
+    napi_create_array_with_length(env, metadatas.size(), &metadataArray);
 
     uint32_t index = 0;
-    for (const auto& metadata : abilityInfo.metadata) {
-        napi_value objVal = nullptr;
-        napi_create_object(env, &objVal);
+    for (const auto& metadata : metadatas) {
+        napi_value objVal = JsObjectBuilder(env)
+            .Set(KEY_NAME, metadata.name)
+            .Set(KEY_VALUE, metadata.value)
+            .Set(KEY_RESOURCE, metadata.resource)
+            .Build();
         if (objVal == nullptr) {
             HILOG_ERROR("Native object value is nullptr.");
             continue;
         }
-
-        napi_set_named_property(env, objVal, "name", CreateJsValue(env, metadata.name));
-        napi_set_named_property(env, objVal, "value", CreateJsValue(env, metadata.value));
-        napi_set_named_property(env, objVal, "resource", CreateJsValue(env, metadata.resource));
-
         napi_set_element(env, metadataArray, index++, objVal);
     }
+    return metadataArray;
+}
+} // namespace
 
-    napi_set_named_property(env, object, "metadata", metadataArray);
-    return object;
+napi_value CreateJsAbilityInfo(napi_env env, const AppExecFwk::AbilityInfo& abilityInfo)
+{
+    HILOG_INFO("CreateJsAbilityInfo call.");
+    return JsObjectBuilder(env)
+        .Set(KEY_BUNDLE_NAME, abilityInfo.bundleName)
+        .Set(KEY_MODULE_NAME, abilityInfo.moduleName)
+        .Set(KEY_NAME, abilityInfo.name)
+        .Set(KEY_LABEL, abilityInfo.label)
+        .Set(KEY_LABEL_ID, abilityInfo.labelId)
+        .Set(KEY_DESCRIPTION, abilityInfo.description)
+        .Set(KEY_DESCRIPTION_ID, abilityInfo.descriptionId)
+        .Set(KEY_ICON, abilityInfo.iconPath)
+        .Set(KEY_ICON_ID, abilityInfo.iconId)
+        .Set(KEY_TYPE, abilityInfo.type)
+        .Set(KEY_LAUNCH_TYPE, abilityInfo.launchMode)
+        .SetValue(KEY_APPLICATION_INFO, CreateJsApplicationInfo(env, abilityInfo.applicationInfo))
+        .SetValue(KEY_METADATA, CreateJsMetadataArray(env, abilityInfo.metadata))
+        .Build();
 }
 
 napi_value CreateJsApplicationInfo(napi_env env, const AppExecFwk::ApplicationInfo &applicationInfo)
 {
-    napi_value object = nullptr;
-    napi_create_object(env, &object);
-    if (object == nullptr) {
-        HILOG_ERROR("Create object failed.");
-        return nullptr;
-    }
-
-    napi_set_named_property(env, object, "name", CreateJsValue(env, applicationInfo.name));
-    napi_set_named_property(env, object, "description", CreateJsValue(env, applicationInfo.description));
-    napi_set_named_property(env, object, "descriptionId", CreateJsValue(env, applicationInfo.descriptionId));
-    napi_set_named_property(env, object, "label", CreateJsValue(env, applicationInfo.label));
-    napi_set_named_property(env, object, "labelId", CreateJsValue(env, applicationInfo.labelId));
-    napi_set_named_property(env, object, "icon", CreateJsValue(env, applicationInfo.iconPath));
-    napi_set_named_property(env, object, "iconId", CreateJsValue(env, applicationInfo.iconId));
-    napi_set_named_property(env, object, "codePath", CreateJsValue(env, applicationInfo.codePath));
-    napi_set_named_property(env, object, "systemApp", CreateJsValue(env, applicationInfo.isSystemApp));
-    return object;
+    return JsObjectBuilder(env)
+        .Set(KEY_NAME, applicationInfo.name)
+        .Set(KEY_DESCRIPTION, applicationInfo.description)
+        .Set(KEY_DESCRIPTION_ID, applicationInfo.descriptionId)
+        .Set(KEY_LABEL, applicationInfo.label)
+        .Set(KEY_LABEL_ID, applicationInfo.labelId)
+        .Set(KEY_ICON, applicationInfo.iconPath)
+        .Set(KEY_ICON_ID, applicationInfo.iconId)
+        .Set(KEY_CODE_PATH, applicationInfo.codePath)
+        .Set(KEY_SYSTEM_APP, applicationInfo.isSystemApp)
+        .Build();
 }
 
 napi_value CreateJsHapModuleInfo(napi_env env, const AppExecFwk::HapModuleInfo& hapModuleInfo)
 {
     HILOG_INFO("CreateJsHapModuleInfo call.");
-    napi_value object = nullptr;
-    napi_create_object(env, &object);
-    if (object == nullptr) {
-        HILOG_ERROR("Create object failed.");
-        return nullptr;
-    }
-
-    napi_set_named_property(env, object, "name", CreateJsValue(env, hapModuleInfo.name));
-    napi_set_named_property(env, object, "icon", CreateJsValue(env, hapModuleInfo.iconPath));
-    napi_set_named_property(env, object, "iconId", CreateJsValue(env, hapModuleInfo.iconId));
-    napi_set_named_property(env, object, "label", CreateJsValue(env, hapModuleInfo.label));
-    napi_set_named_property(env, object, "labelId", CreateJsValue(env, hapModuleInfo.labelId));
-    napi_set_named_property(env, object, "description", CreateJsValue(env, hapModuleInfo.description));
-    napi_set_named_property(env, object, "descriptionId", CreateJsValue(env, hapModuleInfo.descriptionId));
-    napi_set_named_property(env, object, "mainElementName", CreateJsValue(env, hapModuleInfo.mainElementName));
-    
     napi_value abilityInfoArray = nullptr;
     napi_create_array_with_length(env, hapModuleInfo.abilityInfos.size(), &abilityInfoArray);
     
@@ -119,49 +254,33 @@ napi_value CreateJsHapModuleInfo(napi_env env, const AppExecFwk::HapModuleInfo&
         napi_set_element(env, abilityInfoArray, index++, abilityObject);
     }
 
-    napi_set_named_property(env, object, "abilitiesInfo", abilityInfoArray);
-    
-    napi_value metadataArray = nullptr;
-    napi_create_array_with_length(env, hapModuleInfo.metadata.size(), &metadataArray);
-
-    index = 0;
-    for (const auto& metadata : hapModuleInfo.metadata) {
-        napi_value objVal = nullptr;
-        napi_create_object(env, &objVal);
-        if (objVal == nullptr) {
-            HILOG_ERROR("Native object is nullptr.");
-        } else {
-            napi_set_named_property(env, objVal, "name", CreateJsValue(env, metadata.name));
-            napi_set_named_property(env, objVal, "value", CreateJsValue(env, metadata.value));
-            napi_set_named_property(env, objVal, "resource", CreateJsValue(env, metadata.resource));
-        }
-        napi_set_element(env, metadataArray, index++, objVal);
-    }
-    napi_set_named_property(env, object, "metadata", metadataArray);
-    return object;
+    return JsObjectBuilder(env)
+        .Set(KEY_NAME, hapModuleInfo.name)
+        .Set(KEY_ICON, hapModuleInfo.iconPath)
+        .Set(KEY_ICON_ID, hapModuleInfo.iconId)
+        .Set(KEY_LABEL, hapModuleInfo.label)
+        .Set(KEY_LABEL_ID, hapModuleInfo.labelId)
+        .Set(KEY_DESCRIPTION, hapModuleInfo.description)
+        .Set(KEY_DESCRIPTION_ID, hapModuleInfo.descriptionId)
+        .Set(KEY_MAIN_ELEMENT_NAME, hapModuleInfo.mainElementName)
+        .SetValue(KEY_ABILITIES_INFO, abilityInfoArray)
+        .SetValue(KEY_METADATA, CreateJsMetadataArray(env, hapModuleInfo.metadata))
+        .Build();
 }
 
 napi_value CreateJsConfiguration(napi_env env, const Platform::Configuration& configuration)
 {
-    napi_value object = nullptr;
-    napi_create_object(env, &object);
-    if (object == nullptr) {
-        HILOG_ERROR("Native object is nullptr.");
-        return nullptr;
-    }
-
-    napi_set_named_property(env, object, "language", CreateJsValue(env,
-        configuration.GetItem(Platform::ConfigurationInner::APPLICATION_LANGUAGE)));
-    napi_set_named_property(env, object, "colorMode", CreateJsValue(env,
-        configuration.ConvertColorMode(configuration.GetItem(Platform::ConfigurationInner::SYSTEM_COLORMODE))));
-    napi_set_named_property(env, object, "direction", CreateJsValue(env,
-        configuration.ConvertDirection(configuration.GetItem(Platform::ConfigurationInner::APPLICATION_DIRECTION))));
-    napi_set_named_property(env, object, "screenDensity", CreateJsValue(env,
-        configuration.ConvertDensity(configuration.GetItem(Platform::ConfigurationInner::APPLICATION_DENSITYDPI))));
     std::string fontSizeScale = configuration.GetItem(Platform::ConfigurationInner::SYSTEM_FONT_SIZE_SCALE);
-    napi_set_named_property(env, object, "fontSizeScale",
-        CreateJsValue(env, fontSizeScale == "" ? 1.0 : std::stod(fontSizeScale)));
-    return object;
+    return JsObjectBuilder(env)
+        .Set(KEY_LANGUAGE, configuration.GetItem(Platform::ConfigurationInner::APPLICATION_LANGUAGE))
+        .Set(KEY_COLOR_MODE, configuration.ConvertColorMode(
+            configuration.GetItem(Platform::ConfigurationInner::SYSTEM_COLORMODE)))
+        .Set(KEY_DIRECTION, configuration.ConvertDirection(
+            configuration.GetItem(Platform::ConfigurationInner::APPLICATION_DIRECTION)))
+        .Set(KEY_SCREEN_DENSITY, configuration.ConvertDensity(
+            configuration.GetItem(Platform::ConfigurationInner::APPLICATION_DENSITYDPI)))
+        .Set(KEY_FONT_SIZE_SCALE, fontSizeScale == "" ? 1.0 : std::stod(fontSizeScale))
+        .Build();
 }
 
 napi_value CreateJsResourceManager(napi_env env,
@@ -188,33 +307,19 @@ napi_value CreateJsProcessRunningInfoArray(
 
 napi_value CreateJsProcessRunningInfo(napi_env env, const Platform::RunningProcessInfo& info)
 {
-    napi_value object = nullptr;
-    napi_create_object(env, &object);
-    if (object == nullptr) {
-        HILOG_ERROR("Native object is nullptr.");
-        return nullptr;
-    }
-    if (object != nullptr) {
-        napi_set_named_property(env, object, "processName", CreateJsValue(env, info.processName));
-        napi_set_named_property(env, object, "pid", CreateJsValue(env, info.pid));
-        napi_set_named_property(env, object, "bundleNames", CreateNativeArray(env, info.bundleNames));
-    }
-    return object;
+    return JsObjectBuilder(env)
+        .Set(KEY_PROCESS_NAME, info.processName)
+        .Set(KEY_PID, info.pid)
+        .SetValue(KEY_BUNDLE_NAMES, CreateNativeArray(env, info.bundleNames))
+        .Build();
 }
 
 napi_value CreateJsLaunchParam(napi_env env, const Platform::LaunchParam& launchParam)
 {
-    napi_value object = nullptr;
-    napi_create_object(env, &object);
-    if (object == nullptr) {
-        HILOG_ERROR("Native object is nullptr.");
-        return nullptr;
-    }
-
-    napi_set_named_property(env, object, "launchReason", CreateJsValue(env, launchParam.launchReason));
-    napi_set_named_property(env, object, "lastExitReason", CreateJsValue(env, launchParam.lastExitReason));
-
-    return object;
+    return JsObjectBuilder(env)
+        .Set(KEY_LAUNCH_REASON, launchParam.launchReason)
+        .Set(KEY_LAST_EXIT_REASON, launchParam.lastExitReason)
+        .Build();
 }
 } // namespace AbilityRuntime
 } // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,379 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "js_module_cache.h"
+
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "event_handler.h"
+#include "event_runner.h"
+#include "hilog.h"
+#include "js_asset_buffer.h"
+
+namespace OHOS {
+namespace AbilityRuntime {
+namespace {
+constexpr uint32_t CACHE_MAGIC = 0x434d5841; // "AXMC"
+constexpr uint32_t CACHE_FORMAT_VERSION = 3;
+constexpr uint64_t CACHE_PAGE_SIZE = 4096;
+constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+constexpr uint64_t FNV_PRIME = 0x100000001b3ULL;
+constexpr mode_t CACHE_DIR_MODE = 0700;
+constexpr char CACHE_DIR_NAME[] = "/ark_module_cache/";
+constexpr char CACHE_FILE_SUFFIX[] = ".abc";
+constexpr char CACHE_TMP_SUFFIX[] = ".tmp";
+constexpr char CACHE_VERSION_FILE[] = "version";
+constexpr char CACHE_WRITER_NAME[] = "ModuleCacheWriter";
+
+struct CacheHeader {
+    uint32_t magic = CACHE_MAGIC;
+    uint32_t formatVersion = CACHE_FORMAT_VERSION;
+    uint32_t versionCode = 0;
+    uint32_t keySize = 0;
+    uint32_t modulePathSize = 0;
+    uint32_t reserved = 0;
+    uint64_t dataOffset = 0;
+    uint64_t dataSize = 0;
+    uint64_t headerChecksum = 0;
+};
+
+uint64_t HashBytes(const uint8_t* data, size_t size, uint64_t hash = FNV_OFFSET_BASIS)
+{
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= data[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+// Covers the header fields plus the key and module path behind it, the bytecode itself is not hashed.
+uint64_t GetHeaderChecksum(const CacheHeader& header, const uint8_t* meta, size_t metaSize)
+{
+    CacheHeader unsignedHeader = header;
+    unsignedHeader.headerChecksum = 0;
+    uint64_t hash = HashBytes(reinterpret_cast<const uint8_t*>(&unsignedHeader), sizeof(unsignedHeader));
+    return HashBytes(meta, metaSize, hash);
+}
+
+int64_t GetNowMicroseconds()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool WriteAll(int fd, const void* data, size_t size)
+{
+    const uint8_t* cursor = static_cast<const uint8_t*>(data);
+    while (size > 0) {
+        ssize_t written = write(fd, cursor, size);
+        if (written <= 0) {
+            return false;
+        }
+        cursor += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+bool ReadAll(int fd, uint8_t* data, size_t size, off_t offset)
+{
+    while (size > 0) {
+        ssize_t readSize = pread(fd, data, size, offset);
+        if (readSize <= 0) {
+            return false;
+        }
+        data += readSize;
+        offset += readSize;
+        size -= static_cast<size_t>(readSize);
+    }
+    return true;
+}
+
+void RemoveModuleDir(const std::string& moduleDir)
+{
+    DIR* dir = opendir(moduleDir.c_str());
+    if (dir == nullptr) {
+        return;
+    }
+    struct dirent* entry = nullptr;
+    while ((entry = readdir(dir)) != nullptr) {
+        if (entry->d_type == DT_REG) {
+            unlink((moduleDir + entry->d_name).c_str());
+        }
+    }
+    closedir(dir);
+    rmdir(moduleDir.c_str());
+}
+
+// Entries of a previous application version are never loaded again, including those of removed modules.
+void PurgeIfVersionChanged(const std::string& cacheDir, uint32_t versionCode)
+{
+    std::string versionPath = cacheDir + CACHE_VERSION_FILE;
+    uint32_t storedVersionCode = 0;
+    int fd = open(versionPath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd >= 0) {
+        bool result = ReadAll(fd, reinterpret_cast<uint8_t*>(&storedVersionCode), sizeof(storedVersionCode), 0);
+        close(fd);
+        if (result && storedVersionCode == versionCode) {
+            return;
+        }
+    }
+
+    DIR* dir = opendir(cacheDir.c_str());
+    if (dir == nullptr) {
+        return;
+    }
+    struct dirent* entry = nullptr;
+    while ((entry = readdir(dir)) != nullptr) {
+        if (entry->d_type == DT_DIR && strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0) {
+            RemoveModuleDir(cacheDir + entry->d_name + "/");
+        }
+    }
+    closedir(dir);
+
+    fd = open(versionPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        return;
+    }
+    WriteAll(fd, &versionCode, sizeof(versionCode));
+    close(fd);
+    HILOG_INFO("Module cache purged, version code: %{public}u.", versionCode);
+}
+
+void WriteEntry(const std::string& moduleDir, const std::string& entryPath, const std::string& key,
+    const std::string& modulePath, uint32_t versionCode, const JsAssetBuffer& assetBuffer)
+{
+    CacheHeader header;
+    header.versionCode = versionCode;
+    header.keySize = static_cast<uint32_t>(key.size());
+    header.modulePathSize = static_cast<uint32_t>(modulePath.size());
+    std::string meta = key + modulePath;
+    uint64_t metaSize = sizeof(header) + meta.size();
+    header.dataOffset = (metaSize + CACHE_PAGE_SIZE - 1) / CACHE_PAGE_SIZE * CACHE_PAGE_SIZE;
+    header.dataSize = assetBuffer.GetSize();
+    header.headerChecksum = GetHeaderChecksum(header, reinterpret_cast<const uint8_t*>(meta.data()), meta.size());
+
+    mkdir(moduleDir.c_str(), CACHE_DIR_MODE);
+    std::string tmpPath = entryPath + CACHE_TMP_SUFFIX;
+    int fd = open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        HILOG_ERROR("Module cache open failed: %{public}s, errno: %{public}d.", key.c_str(), errno);
+        return;
+    }
+    std::vector<uint8_t> padding(header.dataOffset - metaSize, 0);
+    bool result = WriteAll(fd, &header, sizeof(header)) && WriteAll(fd, meta.data(), meta.size()) &&
+        WriteAll(fd, padding.data(), padding.size()) && WriteAll(fd, assetBuffer.GetData(), assetBuffer.GetSize());
+    close(fd);
+
+    // Publish atomically, a concurrent or crashed writer never leaves a torn entry behind.
+    if (!result || rename(tmpPath.c_str(), entryPath.c_str()) != 0) {
+        HILOG_ERROR("Module cache store failed: %{public}s.", key.c_str());
+        unlink(tmpPath.c_str());
+    }
+}
+} // namespace
+
+JsModuleCache& JsModuleCache::GetInstance()
+{
+    static JsModuleCache instance;
+    return instance;
+}
+
+void JsModuleCache::Init(const std::string& cacheDir, uint32_t versionCode)
+{
+#ifdef IOS_PLATFORM
+    // Modules are plain files inside the application bundle already, a cache would only duplicate them.
+    (void)cacheDir;
+    (void)versionCode;
+#else
+    std::lock_guard<std::mutex> lock(mutex_);
+    cacheDir_ = cacheDir.empty() ? cacheDir : cacheDir + CACHE_DIR_NAME;
+    versionCode_ = versionCode;
+    if (cacheDir_.empty()) {
+        return;
+    }
+    mkdir(cacheDir_.c_str(), CACHE_DIR_MODE);
+    if (writeHandler_ == nullptr) {
+        writeHandler_ = std::make_shared<AppExecFwk::EventHandler>(AppExecFwk::EventRunner::Create(CACHE_WRITER_NAME));
+    }
+    // Entries of another version code fail the header check on load, purging them can wait.
+    writeHandler_->PostTask([cacheDir = cacheDir_, versionCode]() { PurgeIfVersionChanged(cacheDir, versionCode); },
+        "PurgeModuleCache");
+#endif
+}
+
+bool JsModuleCache::IsEnabled()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return !cacheDir_.empty();
+}
+
+std::string JsModuleCache::GetModuleDir(const std::string& moduleName) const
+{
+    std::string moduleDir = moduleName;
+    for (auto& ch : moduleDir) {
+        if (ch == '/') {
+            ch = '_';
+        }
+    }
+    return cacheDir_ + moduleDir + "/";
+}
+
+std::string JsModuleCache::GetEntryPath(const std::string& moduleName, const std::string& key) const
+{
+    uint64_t keyHash = HashBytes(reinterpret_cast<const uint8_t*>(key.data()), key.size());
+    char fileName[32] = { 0 };
+    snprintf(fileName, sizeof(fileName), "%016llx", static_cast<unsigned long long>(keyHash));
+    return GetModuleDir(moduleName) + fileName + CACHE_FILE_SUFFIX;
+}
+
+int JsModuleCache::OpenEntry(const std::string& entryPath, const std::string& key, std::string& modulePath,
+    uint64_t& dataOffset, uint64_t& dataSize)
+{
+    int fd = open(entryPath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return -1;
+    }
+
+    // Only the header page is read, the entry size and the checksummed header stand in for a content check.
+    struct stat fileStat;
+    uint8_t headerPage[CACHE_PAGE_SIZE];
+    CacheHeader header;
+    bool valid = fstat(fd, &fileStat) == 0 && static_cast<uint64_t>(fileStat.st_size) >= CACHE_PAGE_SIZE &&
+        ReadAll(fd, headerPage, sizeof(headerPage), 0);
+    if (valid) {
+        memcpy(&header, headerPage, sizeof(header));
+        uint64_t metaSize = static_cast<uint64_t>(header.keySize) + header.modulePathSize;
+        valid = header.magic == CACHE_MAGIC && header.formatVersion == CACHE_FORMAT_VERSION &&
+            header.versionCode == versionCode_ && header.keySize == key.size() &&
+            sizeof(header) + metaSize <= CACHE_PAGE_SIZE && header.dataOffset % CACHE_PAGE_SIZE == 0 &&
+            header.dataOffset + header.dataSize == static_cast<uint64_t>(fileStat.st_size) &&
+            header.headerChecksum == GetHeaderChecksum(header, headerPage + sizeof(header), metaSize) &&
+            memcmp(headerPage + sizeof(header), key.data(), key.size()) == 0;
+    }
+    if (!valid) {
+        close(fd);
+        unlink(entryPath.c_str());
+        HILOG_WARN("Module cache entry is stale: %{public}s.", key.c_str());
+        return -1;
+    }
+
+    const char* pathBegin = reinterpret_cast<const char*>(headerPage + sizeof(header) + header.keySize);
+    modulePath.assign(pathBegin, header.modulePathSize);
+    dataOffset = header.dataOffset;
+    dataSize = header.dataSize;
+    return fd;
+}
+
+void JsModuleCache::RecordLoad(const std::string& key, bool hit, int64_t beginTime)
+{
+    if (hit) {
+        ++hitCount_;
+    } else {
+        ++missCount_;
+    }
+    HILOG_DEBUG("Module cache %{public}s: %{public}s, hit: %{public}u, miss: %{public}u, cost: %{public}lld us.",
+        hit ? "hit" : "miss", key.c_str(), hitCount_, missCount_,
+        static_cast<long long>(GetNowMicroseconds() - beginTime));
+}
+
+bool JsModuleCache::Load(const std::string& moduleName, const std::string& key, std::string& modulePath,
+    std::vector<uint8_t>& buffer)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (cacheDir_.empty()) {
+        return false;
+    }
+
+    // The caller needs an owned buffer, reading straight into it is cheaper than mapping and copying.
+    int64_t beginTime = GetNowMicroseconds();
+    uint64_t dataOffset = 0;
+    uint64_t dataSize = 0;
+    std::string entryPath = GetEntryPath(moduleName, key);
+    int fd = OpenEntry(entryPath, key, modulePath, dataOffset, dataSize);
+    bool hit = fd >= 0;
+    if (hit) {
+        buffer.resize(dataSize);
+        hit = ReadAll(fd, buffer.data(), buffer.size(), static_cast<off_t>(dataOffset));
+        close(fd);
+        if (!hit) {
+            buffer.clear();
+        }
+    }
+    RecordLoad(key, hit, beginTime);
+    return hit;
+}
+
+std::shared_ptr<JsAssetBuffer> JsModuleCache::LoadMapped(
+    const std::string& moduleName, const std::string& key, std::string& modulePath)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (cacheDir_.empty()) {
+        return nullptr;
+    }
+
+    int64_t beginTime = GetNowMicroseconds();
+    uint64_t dataOffset = 0;
+    uint64_t dataSize = 0;
+    std::string entryPath = GetEntryPath(moduleName, key);
+    int fd = OpenEntry(entryPath, key, modulePath, dataOffset, dataSize);
+    std::shared_ptr<JsAssetBuffer> assetBuffer;
+    if (fd >= 0) {
+        close(fd);
+        assetBuffer = JsAssetBuffer::MapFile(entryPath, dataOffset, dataSize);
+    }
+    RecordLoad(key, assetBuffer != nullptr, beginTime);
+    return assetBuffer;
+}
+
+void JsModuleCache::Store(const std::string& moduleName, const std::string& key, const std::string& modulePath,
+    const std::shared_ptr<JsAssetBuffer>& assetBuffer)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (cacheDir_.empty() || writeHandler_ == nullptr || assetBuffer == nullptr || assetBuffer->GetSize() == 0) {
+        return;
+    }
+    if (sizeof(CacheHeader) + key.size() + modulePath.size() > CACHE_PAGE_SIZE) {
+        return;
+    }
+
+    // Writing the entry copies the whole module to disk, keep it off the launching thread.
+    writeHandler_->PostTask([moduleDir = GetModuleDir(moduleName), entryPath = GetEntryPath(moduleName, key), key,
+        modulePath, versionCode = versionCode_, assetBuffer]() {
+        WriteEntry(moduleDir, entryPath, key, modulePath, versionCode, *assetBuffer);
+    }, "StoreModuleCache");
+}
+
+void JsModuleCache::InvalidateModule(const std::string& moduleName)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (cacheDir_.empty() || writeHandler_ == nullptr) {
+        return;
+    }
+
+    // Queued behind pending stores, so an entry written for the old module does not outlive the invalidation.
+    writeHandler_->PostTask([moduleDir = GetModuleDir(moduleName)]() { RemoveModuleDir(moduleDir); },
+        "InvalidateModuleCache");
+    HILOG_DEBUG("Module cache invalidated: %{public}s.", moduleName.c_str());
+}
+} // namespace AbilityRuntime
+} // namespace OHOS
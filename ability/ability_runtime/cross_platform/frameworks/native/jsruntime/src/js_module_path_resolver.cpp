@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "js_module_path_resolver.h"
+
+namespace OHOS {
+namespace AbilityRuntime {
+namespace {
+constexpr char ABC_SUFFIX[] = ".abc";
+constexpr char KEY_SEPARATOR = '\0';
+}
+
+std::string JsModulePathResolver::RemoveCurrentDirSegments(const std::string& path)
+{
+    // Same result as std::regex_replace(path, std::regex("\\./"), ""): drop every "./" from left to right.
+    std::string result;
+    result.reserve(path.size());
+    size_t index = 0;
+    while (index < path.size()) {
+        if (path[index] == '.' && index + 1 < path.size() && path[index + 1] == '/') {
+            index += 2;
+            continue;
+        }
+        result.push_back(path[index]);
+        ++index;
+    }
+    return result;
+}
+
+std::string JsModulePathResolver::ResolveAbcPath(const std::string& moduleName, const std::string& srcEntrance)
+{
+    size_t dotPos = moduleName.find_last_of('.');
+    std::string fileName = (dotPos != std::string::npos) ? moduleName.substr(dotPos + 1) : moduleName;
+    fileName.append("/").append(srcEntrance);
+    size_t extPos = fileName.rfind('.');
+    if (extPos != std::string::npos) {
+        fileName.erase(extPos);
+    }
+    fileName.append(ABC_SUFFIX);
+    return RemoveCurrentDirSegments(fileName);
+}
+
+JsModuleResolutionCache& JsModuleResolutionCache::GetInstance()
+{
+    static JsModuleResolutionCache instance;
+    return instance;
+}
+
+std::string JsModuleResolutionCache::MakeKey(const std::string& referrer, const std::string& specifier)
+{
+    std::string key;
+    key.reserve(referrer.size() + specifier.size() + 1);
+    key.append(referrer).push_back(KEY_SEPARATOR);
+    key.append(specifier);
+    return key;
+}
+
+void JsModuleResolutionCache::ResetIfStale(uint64_t generation)
+{
+    if (generation_ == generation) {
+        return;
+    }
+    index_.clear();
+    entries_.clear();
+    generation_ = generation;
+}
+
+bool JsModuleResolutionCache::Get(
+    const std::string& referrer, const std::string& specifier, uint64_t generation, std::string& resolved)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    ResetIfStale(generation);
+    auto it = index_.find(MakeKey(referrer, specifier));
+    if (it == index_.end()) {
+        return false;
+    }
+    entries_.splice(entries_.begin(), entries_, it->second);
+    resolved = it->second->second;
+    return true;
+}
+
+void JsModuleResolutionCache::Put(
+    const std::string& referrer, const std::string& specifier, uint64_t generation, const std::string& resolved)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    ResetIfStale(generation);
+    std::string key = MakeKey(referrer, specifier);
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+        it->second->second = resolved;
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return;
+    }
+    if (entries_.size() >= CAPACITY) {
+        index_.erase(entries_.back().first);
+        entries_.pop_back();
+    }
+    entries_.emplace_front(key, resolved);
+    index_.emplace(std::move(key), entries_.begin());
+}
+} // namespace AbilityRuntime
+} // namespace OHOS
@@ -18,6 +18,8 @@
 
 #include "app_main.h"
 #include "hilog.h"
+#include "js_asset_buffer.h"
+#include "js_module_path_resolver.h"
 #include "stage_asset_manager.h"
 
 namespace OHOS {
@@ -38,10 +40,15 @@ bool JsModuleReader::operator()(const std::string& inputPath, uint8_t** buff, si
         HILOG_ERROR("Invalid param");
         return false;
     }
-    moduleBuffer_.clear();
-    std::string moduleName = GetModuleName(inputPath);
+    moduleBuffer_.reset();
+    std::string moduleName;
     std::string modulePath;
-    moduleName = Platform::StageAssetManager::GetInstance()->GetSplicingModuleName(moduleName);
+    auto& resolutionCache = JsModuleResolutionCache::GetInstance();
+    uint64_t generation = Platform::StageAssetManager::GetInstance()->GetModuleGeneration();
+    if (!resolutionCache.Get(bundleName_, inputPath, generation, moduleName)) {
+        moduleName = Platform::StageAssetManager::GetInstance()->GetSplicingModuleName(GetModuleName(inputPath));
+        resolutionCache.Put(bundleName_, inputPath, generation, moduleName);
+    }
     Platform::StageAssetManager::GetInstance()->isDynamicModule(moduleName, true);
     bool isDynamicModule = Platform::StageAssetManager::GetInstance()->IsDynamicUpdateModule(moduleName);
     if (isDynamicModule) {
@@ -49,16 +56,17 @@ bool JsModuleReader::operator()(const std::string& inputPath, uint8_t** buff, si
         Platform::StageAssetManager::GetInstance()->RemoveModuleFilePath(moduleName);
 #endif
     }
-    moduleBuffer_ = Platform::StageAssetManager::GetInstance()->GetModuleBuffer(moduleName, modulePath, true);
-    if (moduleBuffer_.empty()) {
+    moduleBuffer_ = Platform::StageAssetManager::GetInstance()->GetModuleMappedBuffer(moduleName, modulePath, true);
+    if (moduleBuffer_ == nullptr || moduleBuffer_->GetSize() == 0) {
         errorMsg = "modulePath:" + modulePath;
         HILOG_ERROR("GetModuleBuffer failed.");
         return false;
     }
     Platform::AppMain::GetInstance()->ParseHspModuleJson(moduleName);
 
-    *buff = moduleBuffer_.data();
-    *buffSize = moduleBuffer_.size();
+    // The engine only reads the buffer, it stays valid until the next module is resolved.
+    *buff = const_cast<uint8_t*>(moduleBuffer_->GetData());
+    *buffSize = moduleBuffer_->GetSize();
     HILOG_INFO("End, time is: %{public}ld.", GetNowTime());
     return true;
 }
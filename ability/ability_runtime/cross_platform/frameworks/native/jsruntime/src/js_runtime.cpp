@@ -19,7 +19,6 @@
 #include <cerrno>
 #include <climits>
 #include <cstdlib>
-#include <regex>
 #ifndef IOS_PLATFORM
 #include <sys/epoll.h>
 #else
@@ -34,13 +33,17 @@
 #include "event_handler.h"
 #include "hilog.h"
 #include "js_console_log.h"
+#include "js_module_cache.h"
+#include "js_module_path_resolver.h"
 #include "js_module_reader.h"
 #include "js_runtime_utils.h"
 #include "js_timer.h"
+#include "js_timer_wheel.h"
 #include "js_worker.h"
 #include "json_util.h"
 #include "native_engine/impl/ark/ark_native_engine.h"
 #include "stage_asset_manager.h"
+#include "startup_timeline.h"
 
 #include "uncaught_exception_callback.h"
 
@@ -404,6 +407,7 @@ std::unique_ptr<NativeReference> JsRuntime::LoadSystemModuleByEngine(
 
 bool JsRuntime::Initialize(const Options& options)
 {
+    StartupPhase phase("JsRuntime::Initialize");
     HandleScope handleScope(*this);
     napi_value globalObj = nullptr;
     napi_get_global(env_, &globalObj);
@@ -413,6 +417,7 @@ bool JsRuntime::Initialize(const Options& options)
         return false;
     }
 
+    EnableAsyncConsoleLog(options.asyncConsoleLog);
     InitConsoleLogModule(env_, globalObj);
 
     // Simple hook function 'isSystemplugin'
@@ -434,6 +439,7 @@ bool JsRuntime::Initialize(const Options& options)
 
 #ifdef SUPPORT_GRAPHICS
     if (options.loadAce) {
+        StartupPhase preloadPhase("LoadAce");
         NativeEngine* engine = reinterpret_cast<NativeEngine*>(env_);
         OHOS::Ace::Platform::DeclarativeModulePreloader::Preload(*engine);
         env_ = reinterpret_cast<napi_env>(engine);
@@ -454,8 +460,10 @@ bool JsRuntime::Initialize(const Options& options)
 
     uv_run(uvLoop, UV_RUN_NOWAIT);
     codePath_ = options.codePath;
+    JsModuleCache::GetInstance().Init(options.moduleCacheDir, options.versionCode);
     uint32_t events = AppExecFwk::FILE_DESCRIPTOR_INPUT_EVENT | AppExecFwk::FILE_DESCRIPTOR_OUTPUT_EVENT;
     eventHandler_->AddFileDescriptorListener(fd, events, std::make_shared<UvLoopHandler>(uvLoop));
+    timerWheel_ = std::make_shared<JsTimerWheel>(*this);
     InitTimerModule(env_, globalObj);
     auto engine = reinterpret_cast<NativeEngine*>(env_);
     InitWorkerModule(*engine, codePath_, options.isDebugVersion, options.isBundle);
@@ -465,13 +473,19 @@ bool JsRuntime::Initialize(const Options& options)
 
 void JsRuntime::Deinitialize()
 {
+    // Stops the console drain thread after flushing, instead of leaving it to static destruction.
+    EnableAsyncConsoleLog(false);
     for (auto it = modules_.begin(); it != modules_.end(); it = modules_.erase(it)) {
         delete it->second;
         it->second = nullptr;
     }
 
     methodRequireNapiRef_.reset();
-    
+    if (timerWheel_ != nullptr) {
+        timerWheel_->Clear();
+        timerWheel_.reset();
+    }
+
     uv_loop_s* uvLoop = nullptr;
     napi_get_uv_event_loop(env_, &uvLoop);
     auto fd = uvLoop != nullptr ? uv_backend_fd(uvLoop) : -1;
@@ -520,6 +534,7 @@ napi_value JsRuntime::LoadJsBundle(const std::string& path, std::vector<uint8_t>
 // Activate the ACE module automatically.
 void JsRuntime::LoadAce()
 {
+    StartupPhase phase("LoadAce");
     NativeEngine* engine = reinterpret_cast<NativeEngine*>(env_);
     OHOS::Ace::Platform::DeclarativeModulePreloader::Preload(*engine);
     env_ = reinterpret_cast<napi_env>(engine);
@@ -548,15 +563,7 @@ std::unique_ptr<NativeReference> JsRuntime::LoadModule(const std::string& module
         classValue = it->second->GetNapiValue();
     } else {
         if (esmodule) {
-            std::string fileName;
-            std::string moduleNamePath = (moduleName_.find_last_of('.') != std::string::npos)
-                                             ? moduleName_.substr(moduleName_.find_last_of('.') + 1)
-                                             : moduleName_;
-            fileName.append(moduleNamePath).append("/").append(srcEntrance);
-            fileName.erase(fileName.rfind("."));
-            fileName.append(".abc");
-            std::regex pattern(std::string("\\.") + std::string("/"));
-            fileName = std::regex_replace(fileName, pattern, "");
+            std::string fileName = JsModulePathResolver::ResolveAbcPath(moduleName_, srcEntrance);
             classValue = LoadJsModule(fileName, buffer, isDynamicUpdate);
         } else {
             classValue = LoadJsBundle(modulePath, buffer);
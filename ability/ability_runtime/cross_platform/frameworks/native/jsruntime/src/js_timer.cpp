@@ -15,80 +15,19 @@
 
 #include "js_timer.h"
 
-#include <atomic>
-#include <string>
+#include <memory>
 #include <vector>
 
 #include "hilog.h"
 #include "js_runtime.h"
 #include "js_runtime_utils.h"
+#include "js_timer_wheel.h"
 #include "napi/native_common.h"
 
-#ifdef SUPPORT_GRAPHICS
-#include "core/common/container_scope.h"
-#endif
-
-#ifdef SUPPORT_GRAPHICS
-using OHOS::Ace::ContainerScope;
-#endif
-
 namespace OHOS {
 namespace AbilityRuntime {
 namespace {
-class JsTimer;
-    
-std::atomic<uint32_t> g_callbackId(1);
-
 constexpr size_t MIN_SIZE = 2;
-    
-class JsTimer final {
-public:
-    JsTimer(JsRuntime& jsRuntime, const std::shared_ptr<NativeReference>& jsFunction, const std::string &name,
-        int64_t interval, bool isInterval)
-        : jsRuntime_(jsRuntime), jsFunction_(jsFunction), name_(name), interval_(interval), isInterval_(isInterval)
-    {}
-
-    ~JsTimer() = default;
-
-    void operator()() const
-    {
-        if (isInterval_) {
-            jsRuntime_.PostTask(*this, name_, interval_);
-        }
-#ifdef SUPPORT_GRAPHICS
-        // call js function
-        ContainerScope containerScope(containerScopeId_);
-#endif
-        HandleScope handleScope(jsRuntime_);
-
-        std::vector<napi_value> args_;
-        args_.reserve(jsArgs_.size());
-        for (auto arg : jsArgs_) {
-            args_.emplace_back(arg->GetNapiValue());
-        }
-
-        napi_env env = jsRuntime_.GetNapiEnv();
-        napi_value result = nullptr;
-        napi_get_undefined(env, &result);
-        napi_call_function(env, result, jsFunction_->GetNapiValue(), args_.size(), args_.data(), nullptr);
-    }
-
-    void PushArgs(const std::shared_ptr<NativeReference>& ref)
-    {
-        jsArgs_.emplace_back(ref);
-    }
-
-private:
-    JsRuntime& jsRuntime_;
-    std::shared_ptr<NativeReference> jsFunction_;
-    std::vector<std::shared_ptr<NativeReference>> jsArgs_;
-    std::string name_;
-    int64_t interval_ = 0;
-    bool isInterval_ = false;
-#ifdef SUPPORT_GRAPHICS
-    int32_t containerScopeId_ = ContainerScope::CurrentId();
-#endif
-};
 
 napi_value StartTimeoutOrInterval(napi_env env, napi_callback_info info, bool isInterval)
 {
@@ -111,29 +50,29 @@ napi_value StartTimeoutOrInterval(napi_env env, napi_callback_info info, bool is
     napi_ref ref = nullptr;
     napi_create_reference(env, argv[0], 1, &ref);
     std::shared_ptr<NativeReference> jsFunction(reinterpret_cast<NativeReference*>(ref));
-    uint32_t callbackId = g_callbackId.fetch_add(1, std::memory_order_relaxed);
-    std::string name = "JsRuntimeTimer_";
-    name.append(std::to_string(callbackId));
 
     // create timer task
     NativeEngine* engine = reinterpret_cast<NativeEngine*>(env);
     JsRuntime& jsRuntime = *reinterpret_cast<JsRuntime*>(engine->GetJsEngine());
     env = reinterpret_cast<napi_env>(engine);
+    auto timerWheel = jsRuntime.GetTimerWheel();
+    if (timerWheel == nullptr) {
+        HILOG_ERROR("Set callback timer failed with timer wheel is nullptr.");
+        return CreateJsUndefined(env);
+    }
 
     int64_t delayTime = 0;
-    if (argc < MIN_SIZE || !CheckTypeForNapiValue(env, argv[1], napi_number)) {
-        JsTimer task(jsRuntime, jsFunction, name, delayTime, isInterval);
-        jsRuntime.PostTask(task, name, delayTime);
-        return CreateJsValue(env, callbackId);
-    }
-    napi_get_value_int64(env, argv[1], &delayTime);
-    JsTimer task(jsRuntime, jsFunction, name, delayTime, isInterval);
-    for (size_t index = 2; index < argc; ++index) {
-        napi_ref ref = nullptr;
-        napi_create_reference(env, argv[index], 1, &ref);
-        task.PushArgs(std::shared_ptr<NativeReference>(reinterpret_cast<NativeReference*>(ref)));
+    std::vector<std::shared_ptr<NativeReference>> jsArgs;
+    if (argc >= MIN_SIZE && CheckTypeForNapiValue(env, argv[1], napi_number)) {
+        napi_get_value_int64(env, argv[1], &delayTime);
+        jsArgs.reserve(argc - MIN_SIZE);
+        for (size_t index = MIN_SIZE; index < argc; ++index) {
+            napi_ref argRef = nullptr;
+            napi_create_reference(env, argv[index], 1, &argRef);
+            jsArgs.emplace_back(reinterpret_cast<NativeReference*>(argRef));
+        }
     }
-    jsRuntime.PostTask(task, name, delayTime);
+    uint32_t callbackId = timerWheel->AddTimer(jsFunction, std::move(jsArgs), delayTime, isInterval);
     return CreateJsValue(env, callbackId);
 }
 
@@ -166,12 +105,13 @@ napi_value StopTimeoutOrInterval(napi_env env, napi_callback_info info)
 
     uint32_t callbackId = 0;
     napi_get_value_uint32(env, argv[0], &callbackId);
-    std::string name = "JsRuntimeTimer_";
-    name.append(std::to_string(callbackId));
     NativeEngine* engine = reinterpret_cast<NativeEngine*>(env);
     JsRuntime& jsRuntime = *reinterpret_cast<JsRuntime*>(engine->GetJsEngine());
     env = reinterpret_cast<napi_env>(engine);
-    jsRuntime.RemoveTask(name);
+    auto timerWheel = jsRuntime.GetTimerWheel();
+    if (timerWheel != nullptr) {
+        timerWheel->RemoveTimer(callbackId);
+    }
     return CreateJsUndefined(env);
 }
 }
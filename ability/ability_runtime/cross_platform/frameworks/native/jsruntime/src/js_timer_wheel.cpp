@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "js_timer_wheel.h"
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <utility>
+
+#include "hilog.h"
+#include "js_runtime.h"
+#include "js_runtime_utils.h"
+
+#ifdef SUPPORT_GRAPHICS
+#include "core/common/container_scope.h"
+#endif
+
+#ifdef SUPPORT_GRAPHICS
+using OHOS::Ace::ContainerScope;
+#endif
+
+namespace OHOS {
+namespace AbilityRuntime {
+namespace {
+constexpr char TIMERS_DUE_TASK[] = "JsRuntimeTimersDue";
+}
+
+JsTimerWheel::JsTimerWheel(JsRuntime& jsRuntime) : jsRuntime_(jsRuntime)
+{
+    currentTime_ = GetCurrentTime();
+}
+
+int64_t JsTimerWheel::GetCurrentTime()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+uint32_t JsTimerWheel::AddTimer(const std::shared_ptr<NativeReference>& jsFunction,
+    std::vector<std::shared_ptr<NativeReference>>&& jsArgs, int64_t delayTime, bool isInterval)
+{
+    uint32_t timerId = nextTimerId_++;
+    TimerEntry entry;
+    entry.jsFunction = jsFunction;
+    entry.jsArgs = std::move(jsArgs);
+    entry.interval = std::max<int64_t>(delayTime, 0);
+    entry.expireTime = GetCurrentTime() + entry.interval;
+    entry.isInterval = isInterval;
+#ifdef SUPPORT_GRAPHICS
+    entry.containerScopeId = ContainerScope::CurrentId();
+#endif
+    int64_t expireTime = entry.expireTime;
+    timers_.emplace(timerId, std::move(entry));
+    InsertToSlot(timerId, expireTime);
+
+    if (!dispatching_ && (scheduledTime_ < 0 || expireTime < scheduledTime_)) {
+        ScheduleDueTask();
+    }
+    return timerId;
+}
+
+void JsTimerWheel::RemoveTimer(uint32_t timerId)
+{
+    // The id left in its slot is dropped lazily when the wheel passes that slot.
+    timers_.erase(timerId);
+    if (timers_.empty() && !dispatching_) {
+        ScheduleDueTask();
+    }
+}
+
+void JsTimerWheel::Clear()
+{
+    timers_.clear();
+    for (auto& slot : slots_) {
+        slot.clear();
+    }
+    if (scheduledTime_ >= 0) {
+        jsRuntime_.RemoveTask(TIMERS_DUE_TASK);
+        scheduledTime_ = -1;
+    }
+}
+
+void JsTimerWheel::InsertToSlot(uint32_t timerId, int64_t expireTime)
+{
+    slots_[static_cast<size_t>(expireTime & WHEEL_MASK)].emplace_back(timerId);
+}
+
+void JsTimerWheel::OnTimersDue()
+{
+    scheduledTime_ = -1;
+    int64_t now = GetCurrentTime();
+    int64_t steps = std::min<int64_t>(now - currentTime_ + 1, static_cast<int64_t>(WHEEL_SIZE));
+
+    std::vector<std::pair<int64_t, uint32_t>> dueTimers;
+    for (int64_t step = 0; step < steps; ++step) {
+        auto& slot = slots_[static_cast<size_t>((currentTime_ + step) & WHEEL_MASK)];
+        size_t kept = 0;
+        for (uint32_t timerId : slot) {
+            auto it = timers_.find(timerId);
+            if (it == timers_.end()) {
+                continue;
+            }
+            if (it->second.expireTime <= now) {
+                dueTimers.emplace_back(it->second.expireTime, timerId);
+                continue;
+            }
+            slot[kept++] = timerId;
+        }
+        slot.resize(kept);
+    }
+    currentTime_ = now;
+
+    // Timers expiring within the same millisecond share one dispatch, fired in creation order.
+    std::sort(dueTimers.begin(), dueTimers.end());
+    dispatching_ = true;
+    for (const auto& dueTimer : dueTimers) {
+        Dispatch(dueTimer.second, now);
+    }
+    dispatching_ = false;
+    ScheduleDueTask();
+}
+
+void JsTimerWheel::Dispatch(uint32_t timerId, int64_t now)
+{
+    // The timer may have been cleared by a callback fired earlier in this round.
+    auto it = timers_.find(timerId);
+    if (it == timers_.end()) {
+        return;
+    }
+
+    TimerEntry expired;
+    TimerEntry* entry = &it->second;
+    if (entry->isInterval) {
+        entry->expireTime = GetNextExpireTime(*entry, now);
+        InsertToSlot(timerId, entry->expireTime);
+    } else {
+        expired = std::move(it->second);
+        timers_.erase(it);
+        entry = &expired;
+    }
+
+#ifdef SUPPORT_GRAPHICS
+    // call js function
+    ContainerScope containerScope(entry->containerScopeId);
+#endif
+    HandleScope handleScope(jsRuntime_);
+    std::vector<napi_value> args;
+    args.reserve(entry->jsArgs.size());
+    for (const auto& arg : entry->jsArgs) {
+        args.emplace_back(arg->GetNapiValue());
+    }
+    napi_value function = entry->jsFunction->GetNapiValue();
+
+    // The entry must not be touched after the call, clearInterval in the callback releases it.
+    napi_env env = jsRuntime_.GetNapiEnv();
+    napi_value result = nullptr;
+    napi_get_undefined(env, &result);
+    napi_call_function(env, result, function, args.size(), args.data(), nullptr);
+}
+
+int64_t JsTimerWheel::GetNextExpireTime(const TimerEntry& entry, int64_t now)
+{
+    if (entry.interval <= 0) {
+        return now;
+    }
+
+    // Intervals are anchored to their start time, so callback and queueing latency never accumulate.
+    // A late interval skips the missed ticks and fires on the next tick of its epoch, never in the past.
+    int64_t nextExpireTime = entry.expireTime + entry.interval;
+    if (nextExpireTime > now) {
+        return nextExpireTime;
+    }
+    int64_t missedTicks = (now - entry.expireTime) / entry.interval;
+    return entry.expireTime + (missedTicks + 1) * entry.interval;
+}
+
+void JsTimerWheel::ScheduleDueTask()
+{
+    int64_t expireTime = timers_.empty() ? -1 : GetNearestExpireTime();
+    if (expireTime >= 0 && expireTime == scheduledTime_) {
+        return;
+    }
+    if (scheduledTime_ >= 0) {
+        jsRuntime_.RemoveTask(TIMERS_DUE_TASK);
+        scheduledTime_ = -1;
+    }
+    if (timers_.empty()) {
+        for (auto& slot : slots_) {
+            slot.clear();
+        }
+        return;
+    }
+
+    int64_t delayTime = std::max<int64_t>(expireTime - GetCurrentTime(), 0);
+    auto task = [wp = weak_from_this()]() {
+        auto timerWheel = wp.lock();
+        if (timerWheel != nullptr) {
+            timerWheel->OnTimersDue();
+        }
+    };
+    jsRuntime_.PostTask(task, TIMERS_DUE_TASK, delayTime);
+    scheduledTime_ = expireTime;
+}
+
+int64_t JsTimerWheel::GetNearestExpireTime() const
+{
+    int64_t nearest = LLONG_MAX;
+    for (size_t step = 0; step < WHEEL_SIZE; ++step) {
+        int64_t tick = currentTime_ + static_cast<int64_t>(step);
+        int64_t slotNearest = LLONG_MAX;
+        for (uint32_t timerId : slots_[static_cast<size_t>(tick & WHEEL_MASK)]) {
+            auto it = timers_.find(timerId);
+            if (it != timers_.end()) {
+                slotNearest = std::min(slotNearest, it->second.expireTime);
+            }
+        }
+        // A timer expiring within the current revolution beats everything in later slots.
+        if (slotNearest <= tick) {
+            return slotNearest;
+        }
+        nearest = std::min(nearest, slotNearest);
+    }
+    return nearest;
+}
+} // namespace AbilityRuntime
+} // namespace OHOS
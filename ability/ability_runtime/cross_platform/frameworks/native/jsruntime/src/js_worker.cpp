@@ -18,7 +18,7 @@
 #include <cerrno>
 #include <climits>
 #include <cstdlib>
-#include <fstream>
+#include <memory>
 #include <vector>
 #include <unistd.h>
 
@@ -30,8 +30,10 @@
 #include "core/common/container_scope.h"
 #endif
 #include "hilog.h"
+#include "js_asset_buffer.h"
 #include "js_console_log.h"
 #include "js_runtime_utils.h"
+#include "js_worker_asset_cache.h"
 #include "native_engine/impl/ark/ark_native_engine.h"
 #ifdef ANDROID_PLATFORM
 #include "stage_asset_provider.h"
@@ -126,35 +128,48 @@ void OffWorkerFunc(NativeEngine* nativeEngine)
     }
 }
 
-bool ReadAssetData(const std::string& filePath, std::vector<uint8_t>& content, bool isDebugVersion)
+void ReleaseWorkerSafeMemFunc(void* mapper)
+{
+    delete static_cast<std::shared_ptr<JsAssetBuffer>*>(mapper);
+}
+
+bool ReadAssetData(const std::string& filePath, std::shared_ptr<JsAssetBuffer>& assetBuffer, bool isDebugVersion)
 {
-    std::string path;
 #if defined(ANDROID_PLATFORM)
-    content = Platform::StageAssetProvider::GetInstance()->GetAbcPathBuffer(filePath);
-    return true;
+    // Debug builds may push a new script between two worker starts, so they always read the asset.
+    if (!isDebugVersion) {
+        assetBuffer = JsWorkerAssetCache::GetInstance().Get(filePath);
+        if (assetBuffer != nullptr) {
+            return true;
+        }
+    }
+    // Assets inside the apk may be compressed and can not be mapped, the copy is shared through the cache.
+    auto content = Platform::StageAssetProvider::GetInstance()->GetAbcPathBuffer(filePath);
+    if (content.empty()) {
+        HILOG_ERROR("ReadAssetData failed to read file %{private}s", filePath.c_str());
+        return false;
+    }
+    assetBuffer = JsAssetBuffer::FromBuffer(std::move(content));
 #else
     std::string bundleCodeDir = Platform::StageAssetProvider::GetInstance()->GetBundleCodeDir();
-    path = bundleCodeDir + "/" + filePath;
-#endif
-    if (path.empty()) {
-        HILOG_ERROR("ReadAssetData path is empty");
-        return false; 
-    }
-    std::ifstream stream(path.c_str(), std::ios::binary | std::ios::ate);
-    if (!stream.is_open()) {
+    std::string path = bundleCodeDir + "/" + filePath;
+    assetBuffer = JsAssetBuffer::MapFile(path);
+    if (assetBuffer == nullptr) {
         HILOG_ERROR("ReadAssetData failed to open file %{private}s", filePath.c_str());
         return false;
     }
+#endif
 
-    auto fileLen = stream.tellg();
-    if (!isDebugVersion && fileLen > ASSET_FILE_MAX_SIZE) {
+    if (!isDebugVersion && assetBuffer->GetSize() > static_cast<size_t>(ASSET_FILE_MAX_SIZE)) {
         HILOG_ERROR("ReadAssetData failed, file is too large");
+        assetBuffer.reset();
         return false;
     }
-
-    content.resize(fileLen);
-    stream.seekg(0);
-    stream.read(reinterpret_cast<char*>(content.data()), content.size());
+#if defined(ANDROID_PLATFORM)
+    if (!isDebugVersion) {
+        JsWorkerAssetCache::GetInstance().Put(filePath, assetBuffer);
+    }
+#endif
     return true;
 }
 
@@ -249,10 +264,20 @@ struct AssetHelper final {
 #endif
         HILOG_INFO("Get asset, ami: %{private}s", ami.c_str());
         useSecureMem = false;
-        if (!ReadAssetData(ami, content, isDebugVersion_)) {
+        std::shared_ptr<JsAssetBuffer> assetBuffer;
+        if (!ReadAssetData(ami, assetBuffer, isDebugVersion_)) {
             HILOG_ERROR("Get asset buff failed.");
             return;
         }
+        if (assetBuffer != nullptr && buff != nullptr && buffSize != nullptr && mapper != nullptr) {
+            // Hand the mapped file to the worker directly, it is released by ReleaseWorkerSafeMemFunc.
+            *buff = const_cast<uint8_t*>(assetBuffer->GetData());
+            *buffSize = assetBuffer->GetSize();
+            *mapper = static_cast<void*>(new std::shared_ptr<JsAssetBuffer>(std::move(assetBuffer)));
+            useSecureMem = true;
+        } else if (assetBuffer != nullptr) {
+            content.assign(assetBuffer->GetData(), assetBuffer->GetData() + assetBuffer->GetSize());
+        }
     }
 
     std::string codePath_;
@@ -289,6 +314,7 @@ void InitWorkerModule(NativeEngine& engine, const std::string& codePath, bool is
     engine.SetInitWorkerFunc(InitWorkerFunc);
     engine.SetOffWorkerFunc(OffWorkerFunc);
     engine.SetGetAssetFunc(AssetHelper(codePath, isDebugVersion, isBundle));
+    engine.SetReleaseWorkerSafeMemFunc(ReleaseWorkerSafeMemFunc);
     engine.SetGetContainerScopeIdFunc(GetContainerId);
     engine.SetInitContainerScopeFunc(UpdateContainerScope);
     engine.SetFinishContainerScopeFunc(RestoreContainerScope);
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "js_worker_asset_cache.h"
+
+#include <iterator>
+
+#include "hilog.h"
+#include "js_asset_buffer.h"
+
+namespace OHOS {
+namespace AbilityRuntime {
+JsWorkerAssetCache& JsWorkerAssetCache::GetInstance()
+{
+    static JsWorkerAssetCache instance;
+    return instance;
+}
+
+std::shared_ptr<JsAssetBuffer> JsWorkerAssetCache::Get(const std::string& path)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(path);
+    if (it == index_.end()) {
+        ++missCount_;
+        HILOG_DEBUG("Worker asset cache miss, hit: %{public}u, miss: %{public}u.", hitCount_, missCount_);
+        return nullptr;
+    }
+    entries_.splice(entries_.begin(), entries_, it->second);
+    ++hitCount_;
+    HILOG_DEBUG("Worker asset cache hit, hit: %{public}u, miss: %{public}u.", hitCount_, missCount_);
+    return it->second->second;
+}
+
+void JsWorkerAssetCache::EraseEntry(std::list<Entry>::iterator it)
+{
+    totalBytes_ -= it->second->GetSize();
+    index_.erase(it->first);
+    entries_.erase(it);
+}
+
+void JsWorkerAssetCache::Put(const std::string& path, const std::shared_ptr<JsAssetBuffer>& assetBuffer)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (assetBuffer == nullptr) {
+        return;
+    }
+    auto it = index_.find(path);
+    if (it != index_.end()) {
+        EraseEntry(it->second);
+    }
+    if (assetBuffer->GetSize() > CAPACITY_BYTES) {
+        return;
+    }
+    entries_.emplace_front(path, assetBuffer);
+    index_.emplace(path, entries_.begin());
+    totalBytes_ += assetBuffer->GetSize();
+    // A running worker keeps its own reference, evicting only drops the cached one.
+    while (entries_.size() > CAPACITY || totalBytes_ > CAPACITY_BYTES) {
+        EraseEntry(std::prev(entries_.end()));
+    }
+}
+
+void JsWorkerAssetCache::InvalidateModule(const std::string& moduleName)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::string prefix = moduleName + "/";
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        auto current = it++;
+        if (current->first.compare(0, prefix.size(), prefix) == 0) {
+            EraseEntry(current);
+        }
+    }
+}
+} // namespace AbilityRuntime
+} // namespace OHOS
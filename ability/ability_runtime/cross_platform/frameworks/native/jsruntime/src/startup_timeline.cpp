@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "startup_timeline.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <unistd.h>
+
+namespace OHOS {
+namespace AbilityRuntime {
+namespace {
+std::atomic<uint32_t> g_nextThreadIndex { 0 };
+thread_local uint32_t g_threadIndex = g_nextThreadIndex++;
+thread_local uint32_t g_phaseDepth = 0;
+
+std::string EscapeJson(const std::string& value)
+{
+    std::string result;
+    result.reserve(value.size());
+    for (char ch : value) {
+        if (ch == '"' || ch == '\\') {
+            result.push_back('\\');
+        }
+        result.push_back(ch);
+    }
+    return result;
+}
+} // namespace
+
+StartupTimeline& StartupTimeline::GetInstance()
+{
+    static StartupTimeline instance;
+    return instance;
+}
+
+int64_t StartupTimeline::GetNowMicroseconds()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void StartupTimeline::Start()
+{
+    size_t count = std::min(nextSlot_.load(), MAX_PHASE_COUNT);
+    for (size_t i = 0; i < count; ++i) {
+        slots_[i].committed.store(false, std::memory_order_relaxed);
+    }
+    nextSlot_.store(0);
+    startTime_.store(GetNowMicroseconds());
+}
+
+void StartupTimeline::Record(const std::string& name, int64_t beginTime, int64_t endTime, uint32_t depth)
+{
+    size_t index = nextSlot_.fetch_add(1, std::memory_order_relaxed);
+    if (index >= MAX_PHASE_COUNT) {
+        return;
+    }
+    auto& slot = slots_[index];
+    size_t nameLength = std::min(name.size(), MAX_NAME_LENGTH - 1);
+    memcpy(slot.name, name.data(), nameLength);
+    slot.name[nameLength] = '\0';
+    int64_t startTime = startTime_.load(std::memory_order_relaxed);
+    slot.beginTime = beginTime - startTime;
+    slot.endTime = endTime - startTime;
+    slot.threadIndex = g_threadIndex;
+    slot.depth = depth;
+    slot.committed.store(true, std::memory_order_release);
+}
+
+int64_t StartupTimeline::GetElapsedTime() const
+{
+    return GetNowMicroseconds() - startTime_.load(std::memory_order_relaxed);
+}
+
+std::vector<StartupPhaseRecord> StartupTimeline::GetPhases() const
+{
+    std::vector<StartupPhaseRecord> phases;
+    size_t count = std::min(nextSlot_.load(std::memory_order_relaxed), MAX_PHASE_COUNT);
+    phases.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        const auto& slot = slots_[i];
+        if (!slot.committed.load(std::memory_order_acquire)) {
+            continue;
+        }
+        phases.push_back({ slot.name, slot.beginTime, slot.endTime, slot.threadIndex, slot.depth });
+    }
+    std::sort(phases.begin(), phases.end(), [](const StartupPhaseRecord& lhs, const StartupPhaseRecord& rhs) {
+        return lhs.beginTime < rhs.beginTime || (lhs.beginTime == rhs.beginTime && lhs.depth < rhs.depth);
+    });
+    return phases;
+}
+
+std::string StartupTimeline::ExportJson() const
+{
+    std::string result = "[";
+    for (const auto& phase : GetPhases()) {
+        if (result.size() > 1) {
+            result += ",";
+        }
+        result += "{\"name\":\"" + EscapeJson(phase.name) + "\",\"begin\":" + std::to_string(phase.beginTime) +
+            ",\"end\":" + std::to_string(phase.endTime) + ",\"tid\":" + std::to_string(phase.threadIndex) +
+            ",\"depth\":" + std::to_string(phase.depth) + "}";
+    }
+    result += "]";
+    return result;
+}
+
+std::string StartupTimeline::ExportChromeTrace() const
+{
+    std::string pid = std::to_string(getpid());
+    std::string result = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    for (const auto& phase : GetPhases()) {
+        if (!first) {
+            result += ",";
+        }
+        first = false;
+        result += "{\"name\":\"" + EscapeJson(phase.name) + "\",\"cat\":\"startup\",\"ph\":\"X\",\"ts\":" +
+            std::to_string(phase.beginTime) + ",\"dur\":" + std::to_string(phase.endTime - phase.beginTime) +
+            ",\"pid\":" + pid + ",\"tid\":" + std::to_string(phase.threadIndex) + "}";
+    }
+    result += "]}";
+    return result;
+}
+
+StartupPhase::StartupPhase(const std::string& name)
+    : name_(name), beginTime_(StartupTimeline::GetNowMicroseconds()), depth_(g_phaseDepth++)
+{}
+
+StartupPhase::~StartupPhase()
+{
+    --g_phaseDepth;
+    StartupTimeline::GetInstance().Record(name_, beginTime_, StartupTimeline::GetNowMicroseconds(), depth_);
+}
+} // namespace AbilityRuntime
+} // namespace OHOS
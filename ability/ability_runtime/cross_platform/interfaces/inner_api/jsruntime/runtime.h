@@ -45,9 +45,12 @@ public:
         bool preload = false;
         bool isBundle = true;
         bool isDebugVersion = false;
+        bool asyncConsoleLog = false;
         std::string codePath = "";
         std::string bundleName = "";
         std::string appLibPath = "";
+        std::string moduleCacheDir = "";
+        uint32_t versionCode = 0;
         std::map<std::string, std::vector<uint8_t>> pkgContextInfoJsonBufferMap;
         std::map<std::string, std::string> packageNameList;
 #ifdef ANDROID_PLATFORM
@@ -17,6 +17,8 @@
 #define OHOS_ABILITY_BASE_WANT_H
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
@@ -50,6 +52,15 @@ public:
     Want(const Want& want);
     Want& operator=(const Want& want);
 
+    /**
+     * @description: Move constructor of Want class, which takes over the strings and entities of the source.
+     * The params are shared with the source as the copy constructor does, so the source stays usable.
+     * @param want the source instance of Want.
+     * @return None
+     */
+    Want(Want&& want) noexcept;
+    Want& operator=(Want&& want) noexcept;
+
     /**
      * @description: clear the specific want object.
      * @param want Indicates the want to clear
@@ -428,6 +439,20 @@ public:
     void RemoveParam(const std::string& key);
     std::string ToJson() const;
     void ParseJson(const std::string& jsonParams);
+
+    /**
+     * @description: Serializes the whole Want in the compact binary format of WantBinaryCodec.
+     * @return Returns the encoded bytes.
+     */
+    std::string ToBinary() const;
+
+    /**
+     * @description: Replaces this Want with one decoded from the binary format of WantBinaryCodec.
+     * @param data Indicates the encoded bytes, they are read in place.
+     * @param size Indicates the number of encoded bytes.
+     * @return Returns true on success; the Want is left unchanged otherwise.
+     */
+    bool ParseBinary(const uint8_t* data, size_t size);
     bool IsEmpty() const;
 
 public:
@@ -439,6 +464,7 @@ public:
 
 private:
     void InnerCopyWant(const Want& want);
+    void InnerMoveWant(Want& want) noexcept;
     std::shared_ptr<WantParamsInterface> wantParams_;
     std::string type_;
     std::string bundleName_;
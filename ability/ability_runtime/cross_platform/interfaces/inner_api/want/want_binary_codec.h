@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ABILITY_BASE_WANT_BINARY_CODEC_H
+#define OHOS_ABILITY_BASE_WANT_BINARY_CODEC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "base_interfaces.h"
+
+namespace OHOS {
+namespace AAFwk {
+class Want;
+class WantParams;
+
+/**
+ * Versioned binary encoding of a Want, used instead of the JSON text on the native and platform boundary.
+ *
+ * Layout, all integers little endian:
+ *   header:  magic "\0WNB", uint8 version
+ *   want:    string type, bundleName, moduleName, abilityName, action, uri,
+ *            uint32 entity count, string entities, params
+ *   params:  uint32 count, { string key, value }, uint32 fd count, { string key, int32 fd }
+ *   value:   uint8 tag, payload; arrays of numbers are stored as one block of raw elements, other arrays
+ *            and arrays holding null elements carry 0x80 on their element tag and one value per element
+ *   string:  uint32 length, bytes
+ * The leading zero byte never starts a JSON text, so both encodings can share one channel.
+ */
+class WantBinaryCodec final {
+public:
+    static constexpr uint8_t VERSION = 2;
+
+    static bool IsBinary(const uint8_t* data, size_t size);
+    static bool IsBinary(const std::string& data);
+
+    static void Encode(const Want& want, std::string& buffer);
+    static void EncodeParams(const WantParams& wantParams, std::string& buffer);
+
+    /**
+     * Decodes straight from the given bytes, which are not copied apart from the values themselves.
+     * The target is only modified if the whole input is valid.
+     */
+    static bool Decode(const uint8_t* data, size_t size, Want& want);
+    static bool DecodeParams(const uint8_t* data, size_t size, WantParams& wantParams);
+
+private:
+    class Writer;
+    class Reader;
+
+    static void WriteParams(Writer& writer, const WantParams& wantParams);
+    static void WriteValue(Writer& writer, IInterface* value);
+    static void WriteArray(Writer& writer, IArray* array);
+    static bool ReadParams(Reader& reader, WantParams& wantParams, int depth);
+    static bool ReadValue(Reader& reader, sptr<IInterface>& value, int depth);
+    static bool ReadArray(Reader& reader, sptr<IInterface>& value, int depth);
+    static bool ReadBoxedArray(Reader& reader, uint8_t elementTag, sptr<IInterface>& value, int depth);
+};
+} // namespace AAFwk
+} // namespace OHOS
+#endif // OHOS_ABILITY_BASE_WANT_BINARY_CODEC_H
@@ -15,8 +15,12 @@
 #ifndef OHOS_UDMF_ADAPTER_WANT_PARAMS_H
 #define OHOS_UDMF_ADAPTER_WANT_PARAMS_H
 
+#include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <string>
 #include <vector>
 
 #include "base_interfaces.h"
@@ -96,8 +100,34 @@ public:
 
     int GetIntParam(const std::string& key, const int defaultValue) const;
 
+    // Typed arrays are stored unboxed, GetParam still returns them as an IArray.
+    void SetArrayParam(const std::string &key, std::vector<bool> value);
+    void SetArrayParam(const std::string &key, std::vector<byte> value);
+    void SetArrayParam(const std::string &key, std::vector<short> value);
+    void SetArrayParam(const std::string &key, std::vector<int> value);
+    void SetArrayParam(const std::string &key, std::vector<long> value);
+    void SetArrayParam(const std::string &key, std::vector<float> value);
+    void SetArrayParam(const std::string &key, std::vector<double> value);
+    void SetArrayParam(const std::string &key, std::vector<std::string> value);
+
+    bool GetArrayParam(const std::string &key, std::vector<bool> &value) const;
+    bool GetArrayParam(const std::string &key, std::vector<byte> &value) const;
+    bool GetArrayParam(const std::string &key, std::vector<short> &value) const;
+    bool GetArrayParam(const std::string &key, std::vector<int> &value) const;
+    bool GetArrayParam(const std::string &key, std::vector<long> &value) const;
+    bool GetArrayParam(const std::string &key, std::vector<float> &value) const;
+    bool GetArrayParam(const std::string &key, std::vector<double> &value) const;
+    bool GetArrayParam(const std::string &key, std::vector<std::string> &value) const;
+
+    /**
+     * Map view of the parameters, built on first use. It belongs to this object and is kept in step with
+     * every later change of it, including assignment, like the map it replaces.
+     */
     const std::map<std::string, sptr<IInterface>> &GetParams() const;
 
+    // Visits the parameters in key order without building the map view.
+    void ForEachParam(const std::function<void(const std::string &, const sptr<IInterface> &)> &visitor) const;
+
     const std::set<std::string> KeySet() const;
 
     void Remove(const std::string &key);
@@ -150,13 +180,39 @@ private:
         VALUE_TYPE_INVALID_FD = 105,
     };
 
+    // A stored parameter, its type is resolved by GetDataType once when the value is set.
+    struct Param {
+        std::string key;
+        sptr<IInterface> value;
+        int type = VALUE_TYPE_NULL;
+    };
+
+    // Copies share one node, a mutation of a shared node clones only the entries of this level first.
+    // Boxed scalars and nested WantParams can not be changed in place and stay shared. Arrays can, so
+    // they are cloned when the node is detached, which GetParam also does before it hands one out.
+    // Fds are not shared, a copy records duplicates of the fds of its source.
+    struct ParamsNode {
+        std::vector<Param> params;
+        std::map<std::string, int> fds;
+    };
+
     friend class WantParamWrapper;
+    friend class WantBinaryCodec;
     // inner use function
-    bool NewArrayData(IArray *source, sptr<IArray> &dest);
-    bool NewParams(const WantParams &source, WantParams &dest);
-    bool NewFds(const WantParams &source, WantParams &dest);
-    std::map<std::string, sptr<IInterface>> params_;
-    std::map<std::string, int> fds_;
+    const std::map<std::string, int> &GetFds() const;
+    // Parameters sorted by key, each with its type resolved by GetDataType when it was set.
+    const std::vector<Param> &GetSortedParams() const;
+    sptr<IInterface> GetParamValue(const std::string &key) const;
+    void SyncParamsMap() const;
+    void DetachNode() const;
+    void DupCopiedFds();
+    void SetFdParam(const std::string &key, int fd);
+    ParamsNode &MutableNode();
+    void EraseParam(const std::string &key);
+    // Mutable so GetParam can detach a shared node before handing out an array.
+    mutable std::shared_ptr<ParamsNode> node_;
+    mutable std::once_flag paramsMapOnce_;
+    mutable std::unique_ptr<std::map<std::string, sptr<IInterface>>> paramsMap_;
 };
 }  // namespace AAFwk
 }  // namespace OHOS
@@ -116,6 +116,7 @@ public:
     virtual void OnWindowStageCreated();
     virtual void OnWindowStageDestroy();
     void SetWant(const AAFwk::Want& want);
+    void SetWant(AAFwk::Want&& want);
     std::shared_ptr<AAFwk::Want> GetWant();
 
     void SetInstanceName(const std::string& instanceName)
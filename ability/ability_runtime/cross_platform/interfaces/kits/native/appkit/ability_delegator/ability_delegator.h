@@ -16,6 +16,7 @@
 #ifndef OHOS_ABILITY_RUNTIME_ABILITY_DELEGATOR_H
 #define OHOS_ABILITY_RUNTIME_ABILITY_DELEGATOR_H
 
+#include <functional>
 #include <functional>
 #include <list>
 #include <map>
@@ -23,6 +24,7 @@
 #include <mutex>
 #include <string>
 #include <sstream>
+#include <unordered_map>
 #include <vector>
 
 #ifndef SUPPORT_GRAPHICS
@@ -350,6 +352,8 @@ private:
     void RemoveAbilityProperty(const std::shared_ptr<ADelegatorAbilityProperty> &ability);
     std::shared_ptr<ADelegatorAbilityProperty> FindPropertyByName(const std::string &name);
     inline void CallClearFunc(const std::shared_ptr<ADelegatorAbilityProperty> &ability);
+    void DispatchAbilityMonitors(const std::shared_ptr<ADelegatorAbilityProperty> &ability,
+        const std::function<void(const std::shared_ptr<IAbilityMonitor> &)> &func);
 
 private:
     static constexpr size_t INFORMATION_MAX_LENGTH {1000};
@@ -361,8 +365,12 @@ private:
 
     std::unique_ptr<DelegatorThread> delegatorThread_;
     std::list<std::shared_ptr<ADelegatorAbilityProperty>> abilityProperties_;
-    std::vector<std::shared_ptr<IAbilityMonitor>> abilityMonitors_;
-    std::vector<std::shared_ptr<IAbilityStageMonitor>> abilityStageMonitors_;
+    // Monitors are bucketed by the ability name (module name for stage monitors) they were created with. Match
+    // only accepts that exact name, so a lifecycle event visits its own bucket alone, in registration order.
+    std::unordered_map<std::string, std::vector<std::shared_ptr<IAbilityMonitor>>> abilityMonitors_;
+    std::unordered_map<std::string, std::vector<std::shared_ptr<IAbilityStageMonitor>>> abilityStageMonitors_;
+    size_t abilityMonitorsNum_ {0};
+    size_t abilityStageMonitorsNum_ {0};
 
     ClearFunc clearFunc_;
 
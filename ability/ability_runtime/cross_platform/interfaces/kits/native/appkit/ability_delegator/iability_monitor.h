@@ -45,6 +45,13 @@ public:
      */
     virtual ~IAbilityMonitor() = default;
 
+    /**
+     * Obtains the ability name this monitor was created with.
+     *
+     * @return the monitored ability name.
+     */
+    const std::string &GetAbilityName() const;
+
     /**
      * Match the monitored Ability objects when newAbility objects are started or
      * the lifecycle states of monitored abilities have changed.
@@ -46,6 +46,13 @@ public:
      */
     virtual ~IAbilityStageMonitor() = default;
 
+    /**
+     * Obtains the module name this monitor was created with.
+     *
+     * @return the monitored module name.
+     */
+    const std::string &GetModuleName() const;
+
     /**
      * Match the monitored AbilityStage objects when newAbility objects are started.
      *
@@ -44,7 +44,7 @@ public:
     virtual void OnConfigurationUpdate(const Configuration& configuration);
     virtual void Init(const std::shared_ptr<Context>& context);
     std::shared_ptr<Context> GetContext() const;
-    void LaunchAbility(const AAFwk::Want& want, const std::unique_ptr<Runtime>& runtime);
+    void LaunchAbility(AAFwk::Want&& want, const std::unique_ptr<Runtime>& runtime);
     void SetBundleContainer(const std::shared_ptr<AppExecFwk::BundleContainer>& bundleContainer)
     {
         bundleContainer_ = bundleContainer;
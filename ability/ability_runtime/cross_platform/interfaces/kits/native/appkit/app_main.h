@@ -18,6 +18,8 @@
 
 #include <memory>
 #include <mutex>
+#include <string>
+#include <vector>
 
 #include "application.h"
 #include "bundle_container.h"
@@ -65,17 +67,20 @@ public:
 
 private:
     void ScheduleLaunchApplication(bool isCopyNativeLibs, bool shouldLoadUI = true);
+    void LoadBundleInfos();
     bool CreateRuntime(const std::string& bundleName, bool isBundle);
     void ParseBundleComplete();
     void HandleDispatchOnCreate(const std::string& instanceName, const std::string& params);
     void UpdateAbilityBundleName(const std::string& bundleName);
     void HandleDispatchOnNewWant(const std::string& instanceName, const std::string& params = "");
     void HandleDispatchOnForeground(const std::string& instanceName);
+    void ReportLaunchEvent();
     void HandleDispatchOnBackground(const std::string& instanceName);
     void HandleDispatchOnDestroy(const std::string& instanceName);
     void HandleOnConfigurationUpdate(const std::string& jsonConfiguration);
     void HandleInitConfiguration(const std::string& jsonConfiguration);
-    Want TransformToWant(const std::string& instanceName, const std::string& params = "");
+    Want TransformToWant(const std::string& instanceName);
+    bool TransformToWant(const std::string& instanceName, const std::string& params, Want& want);
     void CreateAbilityDelegator(const std::string& bundleName, const std::string& moduleName,
         const std::string& testRunerName, const std::string& timeout, const std::string& socket);
     void LoadUiTestModuleBySocket(const std::string& socket);
@@ -85,6 +90,8 @@ private:
     void HandleApplicationBackground();
     void LoadIcuData();
     void HandlePreloadModule(const std::string& moduleName, const std::string& abilityName);
+    std::string GetHspModuleJsonPath(const std::string& moduleName);
+    bool LoadHspModuleInfo(const std::string& moduleName);
     void HandleLoadModule(const std::string& moduleName, const std::string& entryFile);
     void RegisterUncaughtExceptionHandler(Runtime* runtime);
     void FillUncaughtExceptionInfo(JsEnv::UncaughtExceptionInfo& info, const std::string& hapPath);
@@ -99,6 +106,7 @@ private:
     static std::shared_ptr<AppMain> instance_;
     static std::mutex mutex_;
     bool shouldLoadUI_ = true;
+    bool launchReported_ = false;
 };
 } // namespace Platform
 } // namespace AbilityRuntime
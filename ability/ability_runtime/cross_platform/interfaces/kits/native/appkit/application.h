@@ -48,7 +48,7 @@ public:
     }
 
     void UpdateAbilityBundleName(const std::string& bundleName);
-    void HandleAbilityStage(const AAFwk::Want& want);
+    void HandleAbilityStage(AAFwk::Want&& want);
     void DispatchOnNewWant(const AAFwk::Want& want);
     void DispatchOnForeground(const AAFwk::Want& want);
     void DispatchOnBackground(const AAFwk::Want& want);
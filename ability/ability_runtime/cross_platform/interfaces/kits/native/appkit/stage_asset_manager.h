@@ -16,13 +16,17 @@
 #ifndef FOUNDATION_ABILITY_RUNTIME_CROSS_PLATFORM_INTERFACES_KITS_NATIVE_APPKIT_STAGE_ASSET_MANAGER_H
 #define FOUNDATION_ABILITY_RUNTIME_CROSS_PLATFORM_INTERFACES_KITS_NATIVE_APPKIT_STAGE_ASSET_MANAGER_H
 
+#include <atomic>
 #include <list>
+#include <memory>
 #include <mutex>
 #include <utility>
 #include <vector>
 
 namespace OHOS {
 namespace AbilityRuntime {
+class JsAssetBuffer;
+
 namespace Platform {
 class StageAssetManager {
 public:
@@ -35,6 +39,8 @@ public:
     std::pair<std::string, std::vector<uint8_t>> GetPkgPairByAppDataPath(const std::string& moduleName);
     std::vector<uint8_t> GetFontConfigJsonBuffer(const std::string& moduleName);
     std::vector<uint8_t> GetModuleBuffer(const std::string& moduleName, std::string& modulePath, bool esmodule);
+    std::shared_ptr<JsAssetBuffer> GetModuleMappedBuffer(
+        const std::string& moduleName, std::string& modulePath, bool esmodule);
     std::vector<uint8_t> GetModuleAbilityBuffer(
         const std::string& moduleName, const std::string& abilityName, std::string& modulePath, bool esmodule);
     std::string GetBundleCodeDir() const;
@@ -65,8 +71,22 @@ public:
     void SetBundleName(const std::string& bundleName);
     std::string GetSplicingModuleName(const std::string& moduleName);
     bool IsDynamicUpdateModule(const std::string& moduleName);
+    // Changes whenever the module set or a module.json may have changed, callers caching parsed
+    // module.json data compare it instead of re-reading GetModuleJsonBufferList().
+    uint64_t GetModuleGeneration() const;
 
 private:
+    bool LoadModuleCache(const std::string& moduleName, const std::string& cacheKey, std::string& modulePath,
+        std::vector<uint8_t>& buffer);
+    void StoreModuleCache(const std::string& moduleName, const std::string& cacheKey, const std::string& modulePath,
+        const std::vector<uint8_t>& buffer);
+    void StoreModuleCache(const std::string& moduleName, const std::string& cacheKey, const std::string& modulePath,
+        const std::shared_ptr<JsAssetBuffer>& assetBuffer);
+    void InvalidateModuleCache(const std::string& moduleName);
+    void BumpModuleGeneration();
+
+    std::atomic<uint64_t> moduleGeneration_ {0};
+
     static std::shared_ptr<StageAssetManager> instance_;
     static std::mutex mutex_;
 };
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_ABILITY_RUNTIME_STARTUP_TASK_GRAPH_H
+#define OHOS_ABILITY_RUNTIME_STARTUP_TASK_GRAPH_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace OHOS {
+namespace AbilityRuntime {
+namespace Platform {
+/**
+ * Runs the steps of application launch as a dependency graph on the thread calling Run(), reporting when
+ * every step ran and which dependency it waited on. Launch steps call into the platform asset provider,
+ * which is only used from the launching thread, so parallel work lives inside the steps themselves
+ * (e.g. module.json parsing in BundleContainer) rather than in the graph.
+ */
+class StartupTaskGraph final {
+public:
+    using Task = std::function<void()>;
+
+    struct TaskRecord {
+        std::string name;
+        std::string waitedOn;
+        int64_t startTime = 0;
+        int64_t endTime = 0;
+    };
+
+    StartupTaskGraph() = default;
+    ~StartupTaskGraph() = default;
+
+    StartupTaskGraph(const StartupTaskGraph&) = delete;
+    StartupTaskGraph& operator=(const StartupTaskGraph&) = delete;
+
+    // Dependencies must be added before the task depending on them, so the graph is acyclic by construction.
+    // A rejected task marks the whole graph invalid, Run() then refuses to run any step.
+    bool AddTask(const std::string& name, Task task, const std::vector<std::string>& dependencies = {});
+    bool Run();
+    std::vector<TaskRecord> GetRecords() const;
+    void DumpReport() const;
+
+private:
+    struct TaskNode {
+        Task task;
+        std::vector<size_t> dependents;
+        size_t pendingCount = 0;
+        TaskRecord record;
+    };
+
+    int64_t GetElapsedTime() const;
+    size_t FindTask(const std::string& name) const;
+
+    bool valid_ = true;
+    int64_t beginTime_ = 0;
+    std::vector<TaskNode> nodes_;
+};
+} // namespace Platform
+} // namespace AbilityRuntime
+} // namespace OHOS
+#endif // OHOS_ABILITY_RUNTIME_STARTUP_TASK_GRAPH_H